@@ -18,6 +18,7 @@
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 #include "larpandoracontent/LArHelpers/LArStitchingHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
 
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 #include "larpandoracontent/LArObjects/LArMCParticle.h"
@@ -45,9 +46,9 @@ MasterAlgorithm::MasterAlgorithm() :
     m_printOverallRecoStatus(false),
     m_visualizeOverallRecoStatus(false),
     m_shouldRemoveOutOfTimeHits(true),
+    m_nCRWorkerThreads(1),
     m_pSlicingWorkerInstance(nullptr),
-    m_pSliceNuWorkerInstance(nullptr),
-    m_pSliceCRWorkerInstance(nullptr),
+    m_nSliceWorkerInstances(1),
     m_fullWidthCRWorkerWireGaps(true),
     m_passMCParticlesToWorkerInstances(false),
     m_filePathEnvironmentVariable("FW_SEARCH_PATH"),
@@ -160,6 +161,8 @@ StatusCode MasterAlgorithm::Run()
     if (m_passMCParticlesToWorkerInstances)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CopyMCParticles());
 
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PopulateCaloHitCopyInfoMap());
+
     PfoToFloatMap stitchedPfosToX0Map;
     VolumeIdToHitListMap volumeIdToHitListMap;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetVolumeIdToHitListMap(volumeIdToHitListMap));
@@ -218,11 +221,16 @@ StatusCode MasterAlgorithm::InitializeWorkerInstances()
         if (m_shouldRunSlicing)
             m_pSlicingWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_slicingSettingsFile, "SlicingWorker");
 
-        if (m_shouldRunNeutrinoRecoOption)
-            m_pSliceNuWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_nuSettingsFile, "SliceNuWorker");
+        for (unsigned int instance = 0; instance < m_nSliceWorkerInstances; ++instance)
+        {
+            const std::string suffix((0 == instance) ? "" : std::to_string(instance));
 
-        if (m_shouldRunCosmicRecoOption)
-            m_pSliceCRWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_crSettingsFile, "SliceCRWorker");
+            if (m_shouldRunNeutrinoRecoOption)
+                m_sliceNuWorkerInstances.push_back(this->CreateWorkerInstance(larTPCMap, gapList, m_nuSettingsFile, "SliceNuWorker" + suffix));
+
+            if (m_shouldRunCosmicRecoOption)
+                m_sliceCRWorkerInstances.push_back(this->CreateWorkerInstance(larTPCMap, gapList, m_crSettingsFile, "SliceCRWorker" + suffix));
+        }
     }
     catch (const StatusCodeException &statusCodeException)
     {
@@ -244,10 +252,8 @@ StatusCode MasterAlgorithm::CopyMCParticles() const
     PandoraInstanceList pandoraWorkerInstances(m_crWorkerInstances);
     if (m_pSlicingWorkerInstance)
         pandoraWorkerInstances.push_back(m_pSlicingWorkerInstance);
-    if (m_pSliceNuWorkerInstance)
-        pandoraWorkerInstances.push_back(m_pSliceNuWorkerInstance);
-    if (m_pSliceCRWorkerInstance)
-        pandoraWorkerInstances.push_back(m_pSliceCRWorkerInstance);
+    pandoraWorkerInstances.insert(pandoraWorkerInstances.end(), m_sliceNuWorkerInstances.begin(), m_sliceNuWorkerInstances.end());
+    pandoraWorkerInstances.insert(pandoraWorkerInstances.end(), m_sliceCRWorkerInstances.begin(), m_sliceCRWorkerInstances.end());
 
     LArMCParticleFactory mcParticleFactory;
 
@@ -262,6 +268,27 @@ StatusCode MasterAlgorithm::CopyMCParticles() const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode MasterAlgorithm::PopulateCaloHitCopyInfoMap()
+{
+    const CaloHitList *pCaloHitList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, m_inputHitListName, pCaloHitList));
+
+    m_caloHitCopyInfoMap.reserve(pCaloHitList->size());
+
+    for (const CaloHit *const pCaloHit : *pCaloHitList)
+    {
+        // ATTN Hits that cannot be copied are left out of the store, with any error reported only if a copy is actually requested
+        if (!dynamic_cast<const LArCaloHit *>(pCaloHit))
+            continue;
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->FillCaloHitCopyInfo(pCaloHit, m_caloHitCopyInfoMap[pCaloHit]));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MasterAlgorithm::GetVolumeIdToHitListMap(VolumeIdToHitListMap &volumeIdToHitListMap) const
 {
     const LArTPCMap &larTPCMap(this->GetPandora().GetGeometry()->GetLArTPCMap());
@@ -297,7 +324,8 @@ StatusCode MasterAlgorithm::GetVolumeIdToHitListMap(VolumeIdToHitListMap &volume
 
 StatusCode MasterAlgorithm::RunCosmicRayReconstruction(const VolumeIdToHitListMap &volumeIdToHitListMap) const
 {
-    unsigned int workerCounter(0);
+    PandoraInstanceList activeCRWorkers;
+    std::vector<const CaloHitList *> activeCRWorkerHitLists;
 
     for (const Pandora *const pCRWorker : m_crWorkerInstances)
     {
@@ -307,13 +335,38 @@ StatusCode MasterAlgorithm::RunCosmicRayReconstruction(const VolumeIdToHitListMa
         if (volumeIdToHitListMap.end() == iter)
             continue;
 
-        for (const CaloHit *const pCaloHit : iter->second.m_allHitList)
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pCRWorker, pCaloHit));
+        activeCRWorkers.push_back(pCRWorker);
+        activeCRWorkerHitLists.push_back(&(iter->second.m_allHitList));
+    }
 
-        if (m_printOverallRecoStatus)
-            std::cout << "Running cosmic-ray reconstruction worker instance " << ++workerCounter << " of " << m_crWorkerInstances.size() << std::endl;
+    // ATTN Each worker instance handles an independent lar tpc, so instances can be processed concurrently. Recreation of the output pfos
+    // in the master instance happens later, serially and in the order of the worker instance list.
+    const unsigned int nActiveCRWorkers(activeCRWorkers.size());
+    const unsigned int nThreads(LArThreadingHelper::GetNThreads(m_nCRWorkerThreads, nActiveCRWorkers));
+
+    try
+    {
+        LArThreadingHelper::RunTasks(nThreads, nActiveCRWorkers,
+            [&](const unsigned int /*threadIndex*/, const unsigned int workerIndex)
+            {
+                const Pandora *const pCRWorker(activeCRWorkers.at(workerIndex));
+
+                for (const CaloHit *const pCaloHit : *activeCRWorkerHitLists.at(workerIndex))
+                    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pCRWorker, pCaloHit));
 
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pCRWorker));
+                if (m_printOverallRecoStatus)
+                {
+                    std::cout << "Running cosmic-ray reconstruction worker instance " << (workerIndex + 1) << " of "
+                              << m_crWorkerInstances.size() << std::endl;
+                }
+
+                PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pCRWorker));
+            });
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "MasterAlgorithm: Exception during cosmic-ray reconstruction " << statusCodeException.ToString() << std::endl;
+        return statusCodeException.GetStatusCode();
     }
 
     return STATUS_CODE_SUCCESS;
@@ -529,59 +582,48 @@ StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, Sli
         selectedSliceVector = std::move(sliceVector);
     }
 
-    unsigned int sliceCounter(0);
+    // ATTN Slice i is reconstructed by worker instance pair (i % NSliceWorkerInstances), each pair processing its slices in ascending order
+    // in its own thread. Worker pfos must survive until the best hypotheses are recreated, so pairs are not reset between slices. With a
+    // single pair (the default) this is the original serial behaviour, with each slice seeing the leftovers of all earlier slices. With
+    // more pairs, each slice sees only the leftovers of earlier slices in its own pair, so output differs from the single pair output, but
+    // it is fixed for a given number of pairs and never depends on thread scheduling. Hypotheses are then labelled and collected in slice
+    // order.
+    const unsigned int nSlices(selectedSliceVector.size());
+    const unsigned int nActiveInstances(std::min(m_nSliceWorkerInstances, nSlices));
+    SliceHypotheses sliceNuPfos(nSlices), sliceCRPfos(nSlices);
 
-    for (const CaloHitList &sliceHits : selectedSliceVector)
+    try
     {
-        for (const CaloHit *const pSliceCaloHit : sliceHits)
-        {
-            // ATTN Must ensure we copy the hit actually owned by master instance; access differs with/without slicing enabled
-            const CaloHit *const pCaloHitInMaster(m_shouldRunSlicing ? static_cast<const CaloHit *>(pSliceCaloHit->GetParentAddress()) : pSliceCaloHit);
-
-            if (m_shouldRunNeutrinoRecoOption)
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSliceNuWorkerInstance, pCaloHitInMaster));
-
-            if (m_shouldRunCosmicRecoOption)
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSliceCRWorkerInstance, pCaloHitInMaster));
-        }
+        LArThreadingHelper::RunTasks(nActiveInstances, nActiveInstances,
+            [&](const unsigned int, const unsigned int instanceIndex)
+            {
+                const Pandora *const pSliceNuWorker(m_shouldRunNeutrinoRecoOption ? m_sliceNuWorkerInstances.at(instanceIndex) : nullptr);
+                const Pandora *const pSliceCRWorker(m_shouldRunCosmicRecoOption ? m_sliceCRWorkerInstances.at(instanceIndex) : nullptr);
+
+                for (unsigned int sliceIndex = instanceIndex; sliceIndex < nSlices; sliceIndex += m_nSliceWorkerInstances)
+                {
+                    if (m_printOverallRecoStatus)
+                        std::cout << "Running slice worker instances for slice " << (sliceIndex + 1) << " of " << nSlices << std::endl;
+
+                    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+                        this->ReconstructSlice(selectedSliceVector.at(sliceIndex), pSliceNuWorker, pSliceCRWorker,
+                            sliceNuPfos.at(sliceIndex), sliceCRPfos.at(sliceIndex)));
+                }
+            });
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "MasterAlgorithm: Exception during slice reconstruction " << statusCodeException.ToString() << std::endl;
+        return statusCodeException.GetStatusCode();
+    }
 
+    for (unsigned int sliceIndex = 0; sliceIndex < nSlices; ++sliceIndex)
+    {
         if (m_shouldRunNeutrinoRecoOption)
-        {
-            if (m_printOverallRecoStatus)
-                std::cout << "Running nu worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size() << std::endl;
-
-            const PfoList *pSliceNuPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceNuWorkerInstance));
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceNuWorkerInstance, pSliceNuPfos));
-            nuSliceHypotheses.push_back(*pSliceNuPfos);
-
-            for (const ParticleFlowObject *const pPfo : *pSliceNuPfos)
-            {
-                PandoraContentApi::ParticleFlowObject::Metadata metadata;
-                metadata.m_propertiesToAdd["SliceIndex"] = sliceCounter;
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
-            }
-        }
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->AddSliceHypothesis(sliceIndex, sliceNuPfos.at(sliceIndex), nuSliceHypotheses));
 
         if (m_shouldRunCosmicRecoOption)
-        {
-            if (m_printOverallRecoStatus)
-                std::cout << "Running cr worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size() << std::endl;
-
-            const PfoList *pSliceCRPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceCRWorkerInstance));
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceCRWorkerInstance, pSliceCRPfos));
-            crSliceHypotheses.push_back(*pSliceCRPfos);
-
-            for (const ParticleFlowObject *const pPfo : *pSliceCRPfos)
-            {
-                PandoraContentApi::ParticleFlowObject::Metadata metadata;
-                metadata.m_propertiesToAdd["SliceIndex"] = sliceCounter;
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
-            }
-        }
-
-        ++sliceCounter;
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->AddSliceHypothesis(sliceIndex, sliceCRPfos.at(sliceIndex), crSliceHypotheses));
     }
 
     // ATTN: If we swapped these objects at the start, be sure to swap them back in case we ever want to use sliceVector
@@ -597,6 +639,58 @@ StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, Sli
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode MasterAlgorithm::ReconstructSlice(const CaloHitList &sliceHits, const Pandora *const pSliceNuWorker, const Pandora *const pSliceCRWorker,
+    PfoList &sliceNuPfos, PfoList &sliceCRPfos) const
+{
+    for (const CaloHit *const pSliceCaloHit : sliceHits)
+    {
+        // ATTN Must ensure we copy the hit actually owned by master instance; access differs with/without slicing enabled
+        const CaloHit *const pCaloHitInMaster(m_shouldRunSlicing ? static_cast<const CaloHit *>(pSliceCaloHit->GetParentAddress()) : pSliceCaloHit);
+
+        if (pSliceNuWorker)
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pSliceNuWorker, pCaloHitInMaster));
+
+        if (pSliceCRWorker)
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pSliceCRWorker, pCaloHitInMaster));
+    }
+
+    if (pSliceNuWorker)
+    {
+        const PfoList *pSliceNuPfos(nullptr);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pSliceNuWorker));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*pSliceNuWorker, pSliceNuPfos));
+        sliceNuPfos = *pSliceNuPfos;
+    }
+
+    if (pSliceCRWorker)
+    {
+        const PfoList *pSliceCRPfos(nullptr);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pSliceCRWorker));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*pSliceCRWorker, pSliceCRPfos));
+        sliceCRPfos = *pSliceCRPfos;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::AddSliceHypothesis(const unsigned int sliceIndex, const PfoList &slicePfos, SliceHypotheses &sliceHypotheses) const
+{
+    sliceHypotheses.push_back(slicePfos);
+
+    for (const ParticleFlowObject *const pPfo : slicePfos)
+    {
+        PandoraContentApi::ParticleFlowObject::Metadata metadata;
+        metadata.m_propertiesToAdd["SliceIndex"] = sliceIndex;
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MasterAlgorithm::SelectBestSliceHypotheses(const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses) const
 {
     if (m_printOverallRecoStatus)
@@ -633,11 +727,13 @@ StatusCode MasterAlgorithm::Reset()
     if (m_pSlicingWorkerInstance)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSlicingWorkerInstance));
 
-    if (m_pSliceNuWorkerInstance)
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSliceNuWorkerInstance));
+    m_caloHitCopyInfoMap.clear();
+
+    for (const Pandora *const pSliceNuWorker : m_sliceNuWorkerInstances)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pSliceNuWorker));
 
-    if (m_pSliceCRWorkerInstance)
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSliceCRWorkerInstance));
+    for (const Pandora *const pSliceCRWorker : m_sliceCRWorkerInstances)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pSliceCRWorker));
 
     return STATUS_CODE_SUCCESS;
 }
@@ -645,6 +741,36 @@ StatusCode MasterAlgorithm::Reset()
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode MasterAlgorithm::Copy(const Pandora *const pPandora, const CaloHit *const pCaloHit) const
+{
+    CaloHitCopyInfoMap::const_iterator iter(m_caloHitCopyInfoMap.find(pCaloHit));
+
+    if (m_caloHitCopyInfoMap.end() != iter)
+        return this->Copy(pPandora, pCaloHit, iter->second);
+
+    CaloHitCopyInfo caloHitCopyInfo;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->FillCaloHitCopyInfo(pCaloHit, caloHitCopyInfo));
+
+    return this->Copy(pPandora, pCaloHit, caloHitCopyInfo);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::Copy(const Pandora *const pPandora, const CaloHit *const pCaloHit, const CaloHitCopyInfo &caloHitCopyInfo) const
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(*pPandora, caloHitCopyInfo.m_parameters, m_larCaloHitFactory));
+
+    for (const CaloHitCopyInfo::MCParticleWeightVector::value_type &mcParticleWeight : caloHitCopyInfo.m_mcParticleWeightVector)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            PandoraApi::SetCaloHitToMCParticleRelationship(*pPandora, pCaloHit, mcParticleWeight.first, mcParticleWeight.second));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::FillCaloHitCopyInfo(const CaloHit *const pCaloHit, CaloHitCopyInfo &caloHitCopyInfo) const
 {
     const LArCaloHit *const pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
     if (pLArCaloHit == nullptr)
@@ -652,9 +778,7 @@ StatusCode MasterAlgorithm::Copy(const Pandora *const pPandora, const CaloHit *c
         std::cout << "MasterAlgorithm: Could not cast CaloHit to LArCaloHit" << std::endl;
         return STATUS_CODE_INVALID_PARAMETER;
     }
-    LArCaloHitParameters parameters;
-    pLArCaloHit->FillParameters(parameters);
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(*pPandora, parameters, m_larCaloHitFactory));
+    pLArCaloHit->FillParameters(caloHitCopyInfo.m_parameters);
 
     if (m_passMCParticlesToWorkerInstances)
     {
@@ -664,10 +788,7 @@ StatusCode MasterAlgorithm::Copy(const Pandora *const pPandora, const CaloHit *c
         std::sort(mcParticleVector.begin(), mcParticleVector.end(), LArMCParticleHelper::SortByMomentum);
 
         for (const MCParticle *const pMCParticle : mcParticleVector)
-        {
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
-                PandoraApi::SetCaloHitToMCParticleRelationship(*pPandora, pLArCaloHit, pMCParticle, pLArCaloHit->GetMCParticleWeightMap().at(pMCParticle)));
-        }
+            caloHitCopyInfo.m_mcParticleWeightVector.emplace_back(pMCParticle, pLArCaloHit->GetMCParticleWeightMap().at(pMCParticle));
     }
 
     return STATUS_CODE_SUCCESS;
@@ -1192,6 +1313,18 @@ StatusCode MasterAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "FullWidthCRWorkerWireGaps", m_fullWidthCRWorkerWireGaps));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "NCRWorkerThreads", m_nCRWorkerThreads));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "NSliceWorkerInstances", m_nSliceWorkerInstances));
+
+    if (0 == m_nSliceWorkerInstances)
+    {
+        std::cout << "MasterAlgorithm::ReadSettings - NSliceWorkerInstances must be at least one" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "PassMCParticlesToWorkerInstances", m_passMCParticlesToWorkerInstances));
 
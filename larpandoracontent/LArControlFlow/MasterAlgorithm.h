@@ -94,6 +94,20 @@ protected:
 
     typedef std::map<unsigned int, LArTPCHitList> VolumeIdToHitListMap;
 
+    /**
+     *  @brief  CaloHitCopyInfo class, holding the read-only details required to recreate a master calo hit in any worker instance
+     */
+    class CaloHitCopyInfo
+    {
+    public:
+        typedef std::vector<std::pair<const pandora::MCParticle *, float>> MCParticleWeightVector;
+
+        LArCaloHitParameters m_parameters;              ///< The lar calo hit parameters
+        MCParticleWeightVector m_mcParticleWeightVector; ///< The mc particle weights, sorted by mc particle momentum
+    };
+
+    typedef std::unordered_map<const pandora::CaloHit *, CaloHitCopyInfo> CaloHitCopyInfoMap;
+
     pandora::StatusCode Run();
 
     /**
@@ -106,6 +120,11 @@ protected:
      */
     pandora::StatusCode CopyMCParticles() const;
 
+    /**
+     *  @brief  Populate the store of calo hit copy details for all hits in the named input list, shared by all subsequent hit copies
+     */
+    pandora::StatusCode PopulateCaloHitCopyInfoMap();
+
     /**
      *  @brief  Get the mapping from lar tpc volume id to lists of all hits, and truncated hits
      *
@@ -169,6 +188,27 @@ protected:
      */
     pandora::StatusCode RunSliceReconstruction(SliceVector &sliceVector, SliceHypotheses &nuSliceHypotheses, SliceHypotheses &crSliceHypotheses) const;
 
+    /**
+     *  @brief  Reconstruct a single slice using the provided per-slice worker instances
+     *
+     *  @param  sliceHits the list of slice hits, as owned by the master instance
+     *  @param  pSliceNuWorker the address of the per-slice neutrino reconstruction worker instance (nullptr if not required)
+     *  @param  pSliceCRWorker the address of the per-slice cosmic-ray reconstruction worker instance (nullptr if not required)
+     *  @param  sliceNuPfos to receive the slice neutrino hypothesis
+     *  @param  sliceCRPfos to receive the slice cosmic-ray hypothesis
+     */
+    pandora::StatusCode ReconstructSlice(const pandora::CaloHitList &sliceHits, const pandora::Pandora *const pSliceNuWorker,
+        const pandora::Pandora *const pSliceCRWorker, pandora::PfoList &sliceNuPfos, pandora::PfoList &sliceCRPfos) const;
+
+    /**
+     *  @brief  Label the pfos in a slice hypothesis with the slice index and append the hypothesis to the provided vector
+     *
+     *  @param  sliceIndex the slice index
+     *  @param  slicePfos the slice hypothesis
+     *  @param  sliceHypotheses to receive the slice hypothesis
+     */
+    pandora::StatusCode AddSliceHypothesis(const unsigned int sliceIndex, const pandora::PfoList &slicePfos, SliceHypotheses &sliceHypotheses) const;
+
     /**
      *  @brief  Examine slice hypotheses to identify the most appropriate to provide in final event output
      *
@@ -190,6 +230,23 @@ protected:
      */
     pandora::StatusCode Copy(const pandora::Pandora *const pPandora, const pandora::CaloHit *const pCaloHit) const;
 
+    /**
+     *  @brief  Copy a specified calo hit to the provided pandora instance, using pre-calculated copy details
+     *
+     *  @param  pPandora the address of the target pandora instance
+     *  @param  pCaloHit the address of the calo hit
+     *  @param  caloHitCopyInfo the calo hit copy details
+     */
+    pandora::StatusCode Copy(const pandora::Pandora *const pPandora, const pandora::CaloHit *const pCaloHit, const CaloHitCopyInfo &caloHitCopyInfo) const;
+
+    /**
+     *  @brief  Fill the details required to copy a specified calo hit to a pandora worker instance
+     *
+     *  @param  pCaloHit the address of the calo hit
+     *  @param  caloHitCopyInfo to receive the calo hit copy details
+     */
+    pandora::StatusCode FillCaloHitCopyInfo(const pandora::CaloHit *const pCaloHit, CaloHitCopyInfo &caloHitCopyInfo) const;
+
     /**
      *  @brief  Copy a specified mc particle to the provided pandora instance
      *
@@ -324,9 +381,12 @@ protected:
     bool m_shouldRemoveOutOfTimeHits;   ///< Whether to remove out of time hits
 
     PandoraInstanceList m_crWorkerInstances;          ///< The list of cosmic-ray reconstruction worker instances
+    unsigned int m_nCRWorkerThreads;                  ///< The number of threads running cosmic-ray worker instances (zero for hardware concurrency)
     const pandora::Pandora *m_pSlicingWorkerInstance; ///< The slicing worker instance
-    const pandora::Pandora *m_pSliceNuWorkerInstance; ///< The per-slice neutrino reconstruction worker instance
-    const pandora::Pandora *m_pSliceCRWorkerInstance; ///< The per-slice cosmic-ray reconstruction worker instance
+
+    unsigned int m_nSliceWorkerInstances;         ///< The number of per-slice worker instances of each type, each run in its own thread
+    PandoraInstanceList m_sliceNuWorkerInstances; ///< The pool of per-slice neutrino reconstruction worker instances
+    PandoraInstanceList m_sliceCRWorkerInstances; ///< The pool of per-slice cosmic-ray reconstruction worker instances
 
     bool m_fullWidthCRWorkerWireGaps;        ///< Whether wire-type line gaps in cosmic-ray worker instances should cover all drift time
     bool m_passMCParticlesToWorkerInstances; ///< Whether to pass mc particle details (and links to calo hits) to worker instances
@@ -354,6 +414,7 @@ protected:
 
     float m_inTimeMaxX0;                   ///< Cut on X0 to determine whether particle is clear cosmic ray
     LArCaloHitFactory m_larCaloHitFactory; ///< Factory for creating LArCaloHits during hit copying
+    CaloHitCopyInfoMap m_caloHitCopyInfoMap; ///< The per-event store of calo hit copy details, read-only during worker processing
 };
 
 } // namespace lar_content
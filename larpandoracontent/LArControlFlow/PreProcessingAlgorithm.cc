@@ -12,7 +12,10 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 
-#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+#include "larpandoracontent/LArUtility/KDTreeLinkerToolsT.h"
+
+#include <algorithm>
+#include <cmath>
 
 using namespace pandora;
 
@@ -188,37 +191,60 @@ void PreProcessingAlgorithm::PopulateVoidCaloHitLists() noexcept
 
 void PreProcessingAlgorithm::GetFilteredCaloHitList(const CaloHitList &inputList, CaloHitList &outputList)
 {
-    HitKDTree2D kdTree;
-    HitKDNode2DList hitKDNode2DList;
+    // ATTN Hits are duplicates if separated by less than sqrt(epsilon), so sort the hits by the grid cell containing their position, with
+    // cells larger than this separation. The duplicates of a hit then lie in one of three contiguous ranges of the sorted hits
+    const CaloHitVector caloHitVector(inputList.begin(), inputList.end());
+    HitCellEntryVector hitCellEntryVector;
+    hitCellEntryVector.reserve(caloHitVector.size());
 
-    KDTreeBox hitsBoundingRegion2D = fill_and_bound_2d_kd_tree(inputList, hitKDNode2DList);
-    kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+    for (unsigned int iHit = 0; iHit < caloHitVector.size(); ++iHit)
+    {
+        const CartesianVector &position(caloHitVector.at(iHit)->GetPositionVector());
+        hitCellEntryVector.emplace_back(PreProcessingAlgorithm::GetDuplicateSearchCellIndex(position.GetX()),
+            PreProcessingAlgorithm::GetDuplicateSearchCellIndex(position.GetZ()), iHit);
+    }
+
+    std::sort(hitCellEntryVector.begin(), hitCellEntryVector.end());
 
     // Remove hits that are in the same physical location!
-    for (const CaloHit *const pCaloHit1 : inputList)
+    std::vector<bool> isKept(caloHitVector.size(), false);
+
+    for (unsigned int iHit1 = 0; iHit1 < caloHitVector.size(); ++iHit1)
     {
-        bool isUnique(true);
-        KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit1, m_searchRegion1D, m_searchRegion1D));
+        const CaloHit *const pCaloHit1(caloHitVector.at(iHit1));
+        const std::int64_t xCellIndex1(PreProcessingAlgorithm::GetDuplicateSearchCellIndex(pCaloHit1->GetPositionVector().GetX()));
+        const std::int64_t zCellIndex1(PreProcessingAlgorithm::GetDuplicateSearchCellIndex(pCaloHit1->GetPositionVector().GetZ()));
+        const KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit1, m_searchRegion1D, m_searchRegion1D));
 
-        HitKDNode2DList found;
-        kdTree.search(searchRegionHits, found);
+        bool isUnique(true);
 
-        for (const auto &hit : found)
+        for (std::int64_t xCellIndex = xCellIndex1 - 1; isUnique && (xCellIndex <= xCellIndex1 + 1); ++xCellIndex)
         {
-            const CaloHit *const pCaloHit2(hit.data);
+            HitCellEntryVector::const_iterator iter(
+                std::lower_bound(hitCellEntryVector.begin(), hitCellEntryVector.end(), HitCellEntry(xCellIndex, zCellIndex1 - 1, 0)));
 
-            if (pCaloHit1 == pCaloHit2)
-                continue;
+            for (; (hitCellEntryVector.end() != iter) && (std::get<0>(*iter) == xCellIndex) && (std::get<1>(*iter) <= zCellIndex1 + 1);
+                ++iter)
+            {
+                const unsigned int iHit2(std::get<2>(*iter));
+                const CaloHit *const pCaloHit2(caloHitVector.at(iHit2));
 
-            const float displacementSquared((pCaloHit2->GetPositionVector() - pCaloHit1->GetPositionVector()).GetMagnitudeSquared());
+                if (pCaloHit1 == pCaloHit2)
+                    continue;
 
-            if (displacementSquared < std::numeric_limits<float>::epsilon())
-            {
-                const float deltaMip(pCaloHit2->GetMipEquivalentEnergy() > pCaloHit1->GetMipEquivalentEnergy());
+                const CartesianVector &position2(pCaloHit2->GetPositionVector());
 
-                if ((deltaMip > std::numeric_limits<float>::epsilon()) ||
-                    ((std::fabs(deltaMip) < std::numeric_limits<float>::epsilon()) &&
-                        (outputList.end() != std::find(outputList.begin(), outputList.end(), pCaloHit2))))
+                if ((position2.GetX() < searchRegionHits.dimmin[0]) || (position2.GetX() > searchRegionHits.dimmax[0]) ||
+                    (position2.GetZ() < searchRegionHits.dimmin[1]) || (position2.GetZ() > searchRegionHits.dimmax[1]))
+                    continue;
+
+                const float displacementSquared((position2 - pCaloHit1->GetPositionVector()).GetMagnitudeSquared());
+
+                if (displacementSquared >= std::numeric_limits<float>::epsilon())
+                    continue;
+
+                // ATTN Remove the hit if a duplicate has a higher pulse height, or if a duplicate has already been kept
+                if ((pCaloHit2->GetMipEquivalentEnergy() > pCaloHit1->GetMipEquivalentEnergy()) || isKept.at(iHit2))
                 {
                     isUnique = false;
                     break;
@@ -228,6 +254,7 @@ void PreProcessingAlgorithm::GetFilteredCaloHitList(const CaloHitList &inputList
 
         if (isUnique)
         {
+            isKept.at(iHit1) = true;
             outputList.push_back(pCaloHit1);
         }
         else
@@ -240,6 +267,15 @@ void PreProcessingAlgorithm::GetFilteredCaloHitList(const CaloHitList &inputList
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+std::int64_t PreProcessingAlgorithm::GetDuplicateSearchCellIndex(const float coordinate)
+{
+    // ATTN Twice the duplicate separation, so that rounding cannot place duplicates in non-adjacent cells
+    static const float cellSize(2.f * std::sqrt(std::numeric_limits<float>::epsilon()));
+    return static_cast<std::int64_t>(std::floor(coordinate / cellSize));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PreProcessingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(
@@ -10,16 +10,12 @@
 
 #include "Pandora/Algorithm.h"
 
+#include <cstdint>
+#include <tuple>
+
 namespace lar_content
 {
 
-template <typename, unsigned int>
-class KDTreeLinkerAlgo;
-template <typename, unsigned int>
-class KDTreeNodeInfoT;
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
 /**
  *  @brief  PreProcessingAlgorithm class
  */
@@ -32,9 +28,8 @@ public:
     PreProcessingAlgorithm();
 
 private:
-    typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
-    typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
-    typedef std::vector<HitKDNode2D> HitKDNode2DList;
+    typedef std::tuple<std::int64_t, std::int64_t, unsigned int> HitCellEntry; ///< The x cell index, z cell index and index of a calo hit
+    typedef std::vector<HitCellEntry> HitCellEntryVector;
 
     pandora::StatusCode Reset();
     pandora::StatusCode Run();
@@ -58,6 +53,15 @@ private:
      */
     void GetFilteredCaloHitList(const pandora::CaloHitList &inputList, pandora::CaloHitList &outputList);
 
+    /**
+     *  @brief Get the index of the cell, of the grid used to search for duplicate hits, containing a coordinate
+     *
+     *  @param coordinate the coordinate
+     *
+     *  @return the cell index
+     */
+    static std::int64_t GetDuplicateSearchCellIndex(const float coordinate);
+
     /**
      *  @brief Build separate MCParticleLists for each view
      */
@@ -68,7 +72,7 @@ private:
     float m_mipEquivalentCut;    ///< Minimum mip equivalent energy for calo hit
     float m_minCellLengthScale;  ///< The minimum length scale for calo hit
     float m_maxCellLengthScale;  ///< The maximum length scale for calo hit
-    float m_searchRegion1D;      ///< Search region, applied to each dimension, for look-up from kd-trees
+    float m_searchRegion1D;      ///< Search region, applied to each dimension, within which to look for duplicate hits
     unsigned int m_maxEventHits; ///< The maximum number of hits in an event to proceed with the reconstruction
 
     bool m_onlyAvailableCaloHits;                ///< Whether to only include available calo hits
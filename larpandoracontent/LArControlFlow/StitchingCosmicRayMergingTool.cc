@@ -39,15 +39,32 @@ StitchingCosmicRayMergingTool::StitchingCosmicRayMergingTool() :
 {
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode StitchingCosmicRayMergingTool::Initialize()
+{
+    this->BuildTPCNeighbourMap();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void StitchingCosmicRayMergingTool::Run(const MasterAlgorithm *const pAlgorithm, const PfoList *const pMultiPfoList,
     PfoToLArTPCMap &pfoToLArTPCMap, PfoToFloatMap &stitchedPfosToX0Map)
 {
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
 
-    if (this->GetPandora().GetGeometry()->GetLArTPCMap().size() < 2)
+    const LArTPCMap &larTPCMap(this->GetPandora().GetGeometry()->GetLArTPCMap());
+
+    if (larTPCMap.size() < 2)
         return;
 
+    // ATTN: Geometry may be provided after initialisation, in which case the tpc neighbour map is built on first use
+    if (m_larTPCNeighbourMap.size() != larTPCMap.size())
+        this->BuildTPCNeighbourMap();
+
     if (pfoToLArTPCMap.empty())
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
@@ -77,6 +94,29 @@ void StitchingCosmicRayMergingTool::Run(const MasterAlgorithm *const pAlgorithm,
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void StitchingCosmicRayMergingTool::BuildTPCNeighbourMap()
+{
+    m_larTPCNeighbourMap.clear();
+
+    LArTPCVector larTPCVector;
+    for (const LArTPCMap::value_type &mapEntry : this->GetPandora().GetGeometry()->GetLArTPCMap())
+        larTPCVector.push_back(mapEntry.second);
+    std::sort(larTPCVector.begin(), larTPCVector.end(), LArStitchingHelper::SortTPCs);
+
+    for (const LArTPC *const pLArTPC1 : larTPCVector)
+    {
+        LArTPCVector &neighbourTPCVector(m_larTPCNeighbourMap[pLArTPC1]);
+
+        for (const LArTPC *const pLArTPC2 : larTPCVector)
+        {
+            if (LArStitchingHelper::CanTPCsBeStitched(*pLArTPC1, *pLArTPC2))
+                neighbourTPCVector.push_back(pLArTPC2);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void StitchingCosmicRayMergingTool::SelectPrimaryPfos(const PfoList *pInputPfoList, const PfoToLArTPCMap &pfoToLArTPCMap, PfoList &outputPfoList) const
 {
     for (const ParticleFlowObject *const pPfo : *pInputPfoList)
@@ -139,31 +179,109 @@ void StitchingCosmicRayMergingTool::BuildTPCMaps(const PfoList &inputPfoList, co
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void StitchingCosmicRayMergingTool::BuildEndpointMaps(const LArTPCToPfoMap &larTPCToPfoMap,
+    const ThreeDPointingClusterMap &pointingClusterMap, LArTPCToPfoEndpointMap &positiveXEndpointMap,
+    LArTPCToPfoEndpointMap &negativeXEndpointMap) const
+{
+    for (const LArTPCToPfoMap::value_type &mapEntry : larTPCToPfoMap)
+    {
+        PfoEndpointVector &positiveXEndpoints(positiveXEndpointMap[mapEntry.first]);
+        PfoEndpointVector &negativeXEndpoints(negativeXEndpointMap[mapEntry.first]);
+
+        for (const ParticleFlowObject *const pPfo : mapEntry.second)
+        {
+            ThreeDPointingClusterMap::const_iterator iter(pointingClusterMap.find(pPfo));
+
+            if (pointingClusterMap.end() == iter)
+                continue;
+
+            // Check length of pointing cluster
+            const LArPointingCluster &pointingCluster(iter->second);
+
+            if (pointingCluster.GetLengthSquared() < m_minLengthSquared)
+                continue;
+
+            // Check number of 3D hits in the pfo
+            CaloHitList caloHitList3D;
+            LArPfoHelper::GetCaloHits(pPfo, TPC_3D, caloHitList3D);
+
+            if (caloHitList3D.size() < m_minNCaloHits3D)
+                continue;
+
+            // ATTN: Choose the vertex nearest each tpc face as in LArStitchingHelper::GetClosestVertices, which later confirms the choice
+            const LArPointingCluster::Vertex &innerVertex(pointingCluster.GetInnerVertex());
+            const LArPointingCluster::Vertex &outerVertex(pointingCluster.GetOuterVertex());
+            const float dx(outerVertex.GetPosition().GetX() - innerVertex.GetPosition().GetX());
+
+            if (std::fabs(dx) < std::numeric_limits<float>::epsilon())
+                continue;
+
+            const LArPointingCluster::Vertex &positiveXVertex(dx > 0.f ? outerVertex : innerVertex);
+            const LArPointingCluster::Vertex &negativeXVertex(dx > 0.f ? innerVertex : outerVertex);
+
+            // Pointing clusters must have a non-zero X direction (so that they point across drift volume boundary)
+            if (std::fabs(positiveXVertex.GetDirection().GetX()) >= std::numeric_limits<float>::epsilon())
+                positiveXEndpoints.emplace_back(positiveXVertex.GetPosition().GetX(), pPfo);
+
+            if (std::fabs(negativeXVertex.GetDirection().GetX()) >= std::numeric_limits<float>::epsilon())
+                negativeXEndpoints.emplace_back(negativeXVertex.GetPosition().GetX(), pPfo);
+        }
+
+        const auto sortByX = [](const PfoEndpoint &lhs, const PfoEndpoint &rhs) { return (lhs.first < rhs.first); };
+        std::stable_sort(positiveXEndpoints.begin(), positiveXEndpoints.end(), sortByX);
+        std::stable_sort(negativeXEndpoints.begin(), negativeXEndpoints.end(), sortByX);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPCToPfoMap &larTPCToPfoMap,
     const ThreeDPointingClusterMap &pointingClusterMap, PfoAssociationMatrix &pfoAssociationMatrix) const
 {
+    LArTPCToPfoEndpointMap positiveXEndpointMap, negativeXEndpointMap;
+    this->BuildEndpointMaps(larTPCToPfoMap, pointingClusterMap, positiveXEndpointMap, negativeXEndpointMap);
+
     LArTPCVector larTPCVector;
     for (const auto &mapEntry : larTPCToPfoMap)
         larTPCVector.push_back(mapEntry.first);
     std::sort(larTPCVector.begin(), larTPCVector.end(), LArStitchingHelper::SortTPCs);
 
-    for (LArTPCVector::const_iterator tpcIter1 = larTPCVector.begin(), tpcIterEnd = larTPCVector.end(); tpcIter1 != tpcIterEnd; ++tpcIter1)
+    for (const LArTPC *const pLArTPC1 : larTPCVector)
     {
-        const LArTPC *const pLArTPC1(*tpcIter1);
-        const PfoList &pfoList1(larTPCToPfoMap.at(pLArTPC1));
+        LArTPCNeighbourMap::const_iterator neighbourIter(m_larTPCNeighbourMap.find(pLArTPC1));
+
+        if (m_larTPCNeighbourMap.end() == neighbourIter)
+            continue;
 
-        for (LArTPCVector::const_iterator tpcIter2 = tpcIter1; tpcIter2 != tpcIterEnd; ++tpcIter2)
+        for (const LArTPC *const pLArTPC2 : neighbourIter->second)
         {
-            const LArTPC *const pLArTPC2(*tpcIter2);
-            const PfoList &pfoList2(larTPCToPfoMap.at(pLArTPC2));
+            // ATTN: Consider each pair of tpcs once, in the order in which they are sorted
+            if (LArStitchingHelper::SortTPCs(pLArTPC2, pLArTPC1) || !larTPCToPfoMap.count(pLArTPC2))
+                continue;
 
-            if (!LArStitchingHelper::CanTPCsBeStitched(*pLArTPC1, *pLArTPC2))
+            const bool isPositiveX(pLArTPC2->GetCenterX() - pLArTPC1->GetCenterX() > 0.f);
+            const PfoEndpointVector &endpoints1((isPositiveX ? positiveXEndpointMap : negativeXEndpointMap).at(pLArTPC1));
+            const PfoEndpointVector &endpoints2((isPositiveX ? negativeXEndpointMap : positiveXEndpointMap).at(pLArTPC2));
+
+            if (endpoints1.empty() || endpoints2.empty())
                 continue;
 
-            for (const ParticleFlowObject *const pPfo1 : pfoList1)
+            // Pointing clusters must intersect at a drift volume boundary, so only consider endpoints with a suitable mean x position
+            const float boundaryCenterX(LArStitchingHelper::GetTPCBoundaryCenterX(*pLArTPC1, *pLArTPC2));
+            const float boundaryWidthX(LArStitchingHelper::GetTPCBoundaryWidthX(*pLArTPC1, *pLArTPC2));
+            const float maxLongitudinalDisplacementX(m_maxLongitudinalDisplacementX + boundaryWidthX);
+            const float toleranceX(1.f); // ATTN: Only a preselection, the exact requirement is applied when creating each match
+
+            for (const PfoEndpoint &endpoint1 : endpoints1)
             {
-                for (const ParticleFlowObject *const pPfo2 : pfoList2)
-                    this->CreatePfoMatches(*pLArTPC1, *pLArTPC2, pPfo1, pPfo2, pointingClusterMap, pfoAssociationMatrix);
+                const float minX2(2.f * (boundaryCenterX - maxLongitudinalDisplacementX) - endpoint1.first - toleranceX);
+                const float maxX2(2.f * (boundaryCenterX + maxLongitudinalDisplacementX) - endpoint1.first + toleranceX);
+
+                PfoEndpointVector::const_iterator iter2(std::lower_bound(endpoints2.begin(), endpoints2.end(), minX2,
+                    [](const PfoEndpoint &endpoint, const float x) { return (endpoint.first < x); }));
+
+                for (; (endpoints2.end() != iter2) && (iter2->first <= maxX2); ++iter2)
+                    this->CreatePfoMatches(*pLArTPC1, *pLArTPC2, endpoint1.second, iter2->second, pointingClusterMap, pfoAssociationMatrix);
             }
         }
     }
@@ -189,21 +307,6 @@ void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPC &larTPC1, cons
     const LArPointingCluster &pointingCluster1(iter1->second);
     const LArPointingCluster &pointingCluster2(iter2->second);
 
-    // Check length of pointing clusters
-    if (pointingCluster1.GetLengthSquared() < m_minLengthSquared || pointingCluster2.GetLengthSquared() < m_minLengthSquared)
-        return;
-
-    // Get number of 3D hits in each of the pfos
-    CaloHitList caloHitList3D1;
-    LArPfoHelper::GetCaloHits(pPfo1, TPC_3D, caloHitList3D1);
-
-    CaloHitList caloHitList3D2;
-    LArPfoHelper::GetCaloHits(pPfo2, TPC_3D, caloHitList3D2);
-
-    // Check number of 3D hits in each of the pfos
-    if (caloHitList3D1.size() < m_minNCaloHits3D || caloHitList3D2.size() < m_minNCaloHits3D)
-        return;
-
     // Get closest pair of vertices
     LArPointingCluster::Vertex pointingVertex1, pointingVertex2;
 
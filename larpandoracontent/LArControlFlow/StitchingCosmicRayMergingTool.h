@@ -14,6 +14,8 @@
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
 
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace lar_content
 {
@@ -29,6 +31,7 @@ public:
      */
     StitchingCosmicRayMergingTool();
 
+    pandora::StatusCode Initialize();
     void Run(const MasterAlgorithm *const pAlgorithm, const pandora::PfoList *const pMultiPfoList, PfoToLArTPCMap &pfoToLArTPCMap,
         PfoToFloatMap &stitchedPfosToX0Map);
 
@@ -96,6 +99,13 @@ private:
      */
     void SelectPrimaryPfos(const pandora::PfoList *pInputPfoList, const PfoToLArTPCMap &pfoToLArTPCMap, pandora::PfoList &outputPfoList) const;
 
+    typedef std::unordered_map<const pandora::LArTPC *, pandora::LArTPCVector> LArTPCNeighbourMap;
+
+    /**
+     *  @brief  Build the map from each tpc to the list of tpcs (sorted by position) with which its Pfos can be stitched
+     */
+    void BuildTPCNeighbourMap();
+
     typedef std::unordered_map<const pandora::ParticleFlowObject *, LArPointingCluster> ThreeDPointingClusterMap;
 
     /**
@@ -119,11 +129,28 @@ private:
      */
     void BuildTPCMaps(const pandora::PfoList &inputPfoList, const PfoToLArTPCMap &pfoToLArTPCMap, LArTPCToPfoMap &larTPCToPfoMap) const;
 
+    typedef std::pair<float, const pandora::ParticleFlowObject *> PfoEndpoint;
+    typedef std::vector<PfoEndpoint> PfoEndpointVector;
+    typedef std::unordered_map<const pandora::LArTPC *, PfoEndpointVector> LArTPCToPfoEndpointMap;
+
+    /**
+     *  @brief  Build, for each tpc, lists of the Pfos that are candidates for stitching, with the x positions of their pointing cluster
+     *          vertices nearest the tpc faces at higher and lower x, sorted by these x positions
+     *
+     *  @param  larTPCToPfoMap the input mapping between tpc and Pfos
+     *  @param  pointingClusterMap the input mapping between Pfos and their corresponding 3D pointing clusters
+     *  @param  positiveXEndpointMap the output mapping between tpc and Pfo endpoints nearest its higher x face
+     *  @param  negativeXEndpointMap the output mapping between tpc and Pfo endpoints nearest its lower x face
+     */
+    void BuildEndpointMaps(const LArTPCToPfoMap &larTPCToPfoMap, const ThreeDPointingClusterMap &pointingClusterMap,
+        LArTPCToPfoEndpointMap &positiveXEndpointMap, LArTPCToPfoEndpointMap &negativeXEndpointMap) const;
+
     typedef std::unordered_map<const pandora::ParticleFlowObject *, PfoAssociation> PfoAssociationMap;
     typedef std::unordered_map<const pandora::ParticleFlowObject *, PfoAssociationMap> PfoAssociationMatrix;
 
     /**
-     *  @brief  Create associations between Pfos using 3D pointing clusters
+     *  @brief  Create associations between Pfos using 3D pointing clusters, considering only Pfos in neighbouring tpcs and with
+     *          endpoints that could meet at the shared tpc boundary
      *
      *  @param  larTPCToPfoMap the input mapping between tpc and Pfos
      *  @param  pointingClusterMap the input mapping between Pfos and their corresponding 3D pointing clusters
@@ -133,7 +160,8 @@ private:
         PfoAssociationMatrix &pfoAssociationMatrix) const;
 
     /**
-     *  @brief  Create associations between Pfos using 3D pointing clusters
+     *  @brief  Create associations between Pfos using 3D pointing clusters. The Pfos are assumed to satisfy the length and hit
+     *          requirements applied in BuildEndpointMaps
      *
      *  @param  larTPC1 the tpc description for the first Pfo
      *  @param  larTPC2 the tpc description for the second Pfo
@@ -242,6 +270,8 @@ private:
     unsigned int m_minNCaloHits3D;
     float m_maxX0FractionalDeviation; ///< The maximum allowed fractional difference of an X0 contribution for matches to be stitched
     float m_boundaryToleranceWidth;   ///< The distance from the APA/CPA boundary inside which the deviation consideration is ignored
+
+    LArTPCNeighbourMap m_larTPCNeighbourMap; ///< The map from each tpc to the tpcs with which its Pfos can be stitched
 };
 
 } // namespace lar_content
@@ -0,0 +1,340 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArClusterCacheHelper.h
+ *
+ *  @brief  Header file for the cluster cache helper template class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_CLUSTER_CACHE_HELPER_H
+#define LAR_CLUSTER_CACHE_HELPER_H 1
+
+#include "Objects/Cluster.h"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace pandora
+{
+class Pandora;
+} // namespace pandora
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArClusterCacheHelper class template, providing an event-scoped cache of results calculated from clusters, shared by all
+ *          algorithms that opt in within a pandora instance. Results are keyed by cluster and by the settings used to calculate them, and
+ *          a cached result is only used if the cluster still contains exactly the calo hits (in the same order) from which it was made,
+ *          so modified, merged or deleted (and reallocated) clusters are recalculated automatically. Each algorithm using a cache must
+ *          call Reset from its own Reset method and Erase from its destructor, so that the cache lifetime follows the pandora instance.
+ */
+template <typename KEY, typename RESULT>
+class LArClusterCacheHelper
+{
+public:
+    /**
+     *  @brief  CacheStatistics class
+     */
+    class CacheStatistics
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        CacheStatistics();
+
+        unsigned int m_nHits;          ///< The number of requests served from the cache
+        unsigned int m_nMisses;        ///< The number of requests requiring a new result to be calculated
+        unsigned int m_nInvalidations; ///< The number of cached results discarded because the cluster had been modified
+    };
+
+    /**
+     *  @brief  Get the result for a cluster from the cache for the pandora instance, calculating and caching the result if required. The
+     *          result is calculated without holding the cache lock, so concurrent callers are not serialised. The returned reference
+     *          remains valid until the cache is reset, or until a request for the same cluster and key finds that the cluster has been
+     *          modified. Callers should therefore copy the result if it is to be kept.
+     *
+     *  @param  pandora the pandora instance
+     *  @param  pCluster address of the cluster
+     *  @param  key the settings used to calculate the result
+     *  @param  calculator the callable calculating a new result, returning a std::unique_ptr<const RESULT>
+     *
+     *  @return the result
+     *
+     *  @throw  StatusCodeException, as for the calculator (failed calculations are not cached)
+     */
+    template <typename CALCULATOR>
+    static const RESULT &GetResult(const pandora::Pandora &pandora, const pandora::Cluster *const pCluster, const KEY &key,
+        const CALCULATOR &calculator);
+
+    /**
+     *  @brief  Reset the cache for a pandora instance, discarding all results and statistics. To be called from the Reset method of
+     *          each algorithm using the cache, so that the cache is cleared whenever the pandora instance is reset between events
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void Reset(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Erase the cache for a pandora instance, releasing all memory. To be called from the destructor of each algorithm using
+     *          the cache, so that no cache outlives its pandora instance
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void Erase(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Get the cache statistics for a pandora instance, accumulated since the last reset
+     *
+     *  @param  pandora the pandora instance
+     *
+     *  @return the cache statistics
+     */
+    static CacheStatistics GetStatistics(const pandora::Pandora &pandora);
+
+private:
+    /**
+     *  @brief  CacheEntry class
+     */
+    class CacheEntry
+    {
+    public:
+        KEY m_key;                               ///< The settings used to calculate the result
+        pandora::CaloHitVector m_caloHitVector;  ///< The cluster calo hits from which the result was made
+        std::unique_ptr<const RESULT> m_pResult; ///< The result
+    };
+
+    typedef std::vector<CacheEntry> CacheEntryVector;
+    typedef std::unordered_map<const pandora::Cluster *, CacheEntryVector> ClusterToCacheEntryMap;
+
+    /**
+     *  @brief  Cache class, holding the cached results for a single pandora instance
+     */
+    class Cache
+    {
+    public:
+        std::mutex m_mutex;                              ///< The mutex protecting the cache contents
+        ClusterToCacheEntryMap m_clusterToCacheEntryMap; ///< The map from cluster to cache entries
+        CacheStatistics m_statistics;                    ///< The cache statistics
+    };
+
+    typedef std::unordered_map<const pandora::Pandora *, std::unique_ptr<Cache>> PandoraToCacheMap;
+
+    /**
+     *  @brief  Get the cache for a pandora instance, creating it if required
+     *
+     *  @param  pandora the pandora instance
+     *
+     *  @return the cache
+     */
+    static Cache &GetCache(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Find a valid cached result, discarding any cached result for a cluster that has since been modified. The caller must hold
+     *          the cache mutex
+     *
+     *  @param  cache the cache
+     *  @param  pCluster address of the cluster
+     *  @param  key the settings used to calculate the result
+     *
+     *  @return address of the cached result, nullptr if no valid result is cached
+     */
+    static const RESULT *FindResult(Cache &cache, const pandora::Cluster *const pCluster, const KEY &key);
+
+    /**
+     *  @brief  Get the calo hits of a cluster, ordered by layer
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  caloHitVector to receive the calo hits
+     */
+    static void GetCaloHitVector(const pandora::Cluster *const pCluster, pandora::CaloHitVector &caloHitVector);
+
+    /**
+     *  @brief  Whether a cluster contains exactly the specified calo hits, ordered by layer
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  caloHitVector the calo hits
+     *
+     *  @return boolean
+     */
+    static bool HasCaloHits(const pandora::Cluster *const pCluster, const pandora::CaloHitVector &caloHitVector);
+
+    static std::mutex m_cacheMapMutex;            ///< The mutex protecting the map of per-instance caches
+    static PandoraToCacheMap m_pandoraToCacheMap; ///< The map from pandora instance to cache
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename KEY, typename RESULT>
+std::mutex LArClusterCacheHelper<KEY, RESULT>::m_cacheMapMutex;
+
+template <typename KEY, typename RESULT>
+typename LArClusterCacheHelper<KEY, RESULT>::PandoraToCacheMap LArClusterCacheHelper<KEY, RESULT>::m_pandoraToCacheMap;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename KEY, typename RESULT>
+template <typename CALCULATOR>
+inline const RESULT &LArClusterCacheHelper<KEY, RESULT>::GetResult(
+    const pandora::Pandora &pandora, const pandora::Cluster *const pCluster, const KEY &key, const CALCULATOR &calculator)
+{
+    Cache &cache(LArClusterCacheHelper::GetCache(pandora));
+
+    {
+        const std::lock_guard<std::mutex> lock(cache.m_mutex);
+        const RESULT *const pCachedResult(LArClusterCacheHelper::FindResult(cache, pCluster, key));
+
+        if (pCachedResult)
+        {
+            ++cache.m_statistics.m_nHits;
+            return *pCachedResult;
+        }
+    }
+
+    // ATTN If another caller cached a result for the same cluster and key in the meantime, that result is returned and this one discarded
+    std::unique_ptr<const RESULT> pResult(calculator());
+
+    pandora::CaloHitVector caloHitVector;
+    LArClusterCacheHelper::GetCaloHitVector(pCluster, caloHitVector);
+
+    const std::lock_guard<std::mutex> lock(cache.m_mutex);
+    const RESULT *const pCachedResult(LArClusterCacheHelper::FindResult(cache, pCluster, key));
+    ++cache.m_statistics.m_nMisses;
+
+    if (pCachedResult)
+        return *pCachedResult;
+
+    const RESULT &result(*pResult);
+    cache.m_clusterToCacheEntryMap[pCluster].push_back(CacheEntry{key, std::move(caloHitVector), std::move(pResult)});
+
+    return result;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename KEY, typename RESULT>
+inline void LArClusterCacheHelper<KEY, RESULT>::Reset(const pandora::Pandora &pandora)
+{
+    Cache &cache(LArClusterCacheHelper::GetCache(pandora));
+    const std::lock_guard<std::mutex> lock(cache.m_mutex);
+
+    cache.m_clusterToCacheEntryMap.clear();
+    cache.m_statistics = CacheStatistics();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename KEY, typename RESULT>
+inline void LArClusterCacheHelper<KEY, RESULT>::Erase(const pandora::Pandora &pandora)
+{
+    const std::lock_guard<std::mutex> lock(m_cacheMapMutex);
+    m_pandoraToCacheMap.erase(&pandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename KEY, typename RESULT>
+inline typename LArClusterCacheHelper<KEY, RESULT>::CacheStatistics LArClusterCacheHelper<KEY, RESULT>::GetStatistics(
+    const pandora::Pandora &pandora)
+{
+    Cache &cache(LArClusterCacheHelper::GetCache(pandora));
+    const std::lock_guard<std::mutex> lock(cache.m_mutex);
+
+    return cache.m_statistics;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename KEY, typename RESULT>
+inline typename LArClusterCacheHelper<KEY, RESULT>::Cache &LArClusterCacheHelper<KEY, RESULT>::GetCache(const pandora::Pandora &pandora)
+{
+    const std::lock_guard<std::mutex> lock(m_cacheMapMutex);
+    std::unique_ptr<Cache> &pCache(m_pandoraToCacheMap[&pandora]);
+
+    if (!pCache)
+        pCache.reset(new Cache);
+
+    return *pCache;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename KEY, typename RESULT>
+inline const RESULT *LArClusterCacheHelper<KEY, RESULT>::FindResult(Cache &cache, const pandora::Cluster *const pCluster, const KEY &key)
+{
+    typename ClusterToCacheEntryMap::iterator mapIter(cache.m_clusterToCacheEntryMap.find(pCluster));
+
+    if (cache.m_clusterToCacheEntryMap.end() == mapIter)
+        return nullptr;
+
+    CacheEntryVector &cacheEntryVector(mapIter->second);
+    typename CacheEntryVector::iterator iter(std::find_if(
+        cacheEntryVector.begin(), cacheEntryVector.end(), [&](const CacheEntry &cacheEntry) { return (key == cacheEntry.m_key); }));
+
+    if (cacheEntryVector.end() == iter)
+        return nullptr;
+
+    if (LArClusterCacheHelper::HasCaloHits(pCluster, iter->m_caloHitVector))
+        return iter->m_pResult.get();
+
+    ++cache.m_statistics.m_nInvalidations;
+    cacheEntryVector.erase(iter);
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename KEY, typename RESULT>
+inline void LArClusterCacheHelper<KEY, RESULT>::GetCaloHitVector(
+    const pandora::Cluster *const pCluster, pandora::CaloHitVector &caloHitVector)
+{
+    caloHitVector.reserve(pCluster->GetNCaloHits());
+
+    for (const pandora::OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+        caloHitVector.insert(caloHitVector.end(), layerEntry.second->begin(), layerEntry.second->end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename KEY, typename RESULT>
+inline bool LArClusterCacheHelper<KEY, RESULT>::HasCaloHits(
+    const pandora::Cluster *const pCluster, const pandora::CaloHitVector &caloHitVector)
+{
+    if (pCluster->GetNCaloHits() != caloHitVector.size())
+        return false;
+
+    pandora::CaloHitVector::const_iterator hitIter(caloHitVector.begin());
+
+    for (const pandora::OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+    {
+        for (const pandora::CaloHit *const pCaloHit : *layerEntry.second)
+        {
+            if ((caloHitVector.end() == hitIter) || (pCaloHit != *hitIter))
+                return false;
+
+            ++hitIter;
+        }
+    }
+
+    return (caloHitVector.end() == hitIter);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename KEY, typename RESULT>
+inline LArClusterCacheHelper<KEY, RESULT>::CacheStatistics::CacheStatistics() :
+    m_nHits(0),
+    m_nMisses(0),
+    m_nInvalidations(0)
+{
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_CLUSTER_CACHE_HELPER_H
@@ -148,15 +148,17 @@ float LArClusterHelper::GetClosestDistance(const ClusterList &clusterList1, cons
     if (clusterList1.empty() || clusterList2.empty())
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
+    BoundingBoxVector boundingBoxVector2;
+
+    for (const Cluster *const pCluster2 : clusterList2)
+        boundingBoxVector2.emplace_back(pCluster2);
+
     float closestDistance(std::numeric_limits<float>::max());
 
     for (ClusterList::const_iterator iter1 = clusterList1.begin(), iterEnd1 = clusterList1.end(); iter1 != iterEnd1; ++iter1)
     {
         const Cluster *const pCluster1 = *iter1;
-        const float thisDistance(LArClusterHelper::GetClosestDistance(pCluster1, clusterList2));
-
-        if (thisDistance < closestDistance)
-            closestDistance = thisDistance;
+        LArClusterHelper::UpdateClosestDistance(pCluster1, BoundingBox(pCluster1), clusterList2, boundingBoxVector2, closestDistance);
     }
 
     return closestDistance;
@@ -169,16 +171,13 @@ float LArClusterHelper::GetClosestDistance(const Cluster *const pCluster, const
     if (clusterList.empty())
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-    float closestDistance(std::numeric_limits<float>::max());
+    BoundingBoxVector boundingBoxVector;
 
-    for (ClusterList::const_iterator iter = clusterList.begin(), iterEnd = clusterList.end(); iter != iterEnd; ++iter)
-    {
-        const Cluster *const pTestCluster = *iter;
-        const float thisDistance(LArClusterHelper::GetClosestDistance(pCluster, pTestCluster));
+    for (const Cluster *const pTestCluster : clusterList)
+        boundingBoxVector.emplace_back(pTestCluster);
 
-        if (thisDistance < closestDistance)
-            closestDistance = thisDistance;
-    }
+    float closestDistance(std::numeric_limits<float>::max());
+    LArClusterHelper::UpdateClosestDistance(pCluster, BoundingBox(pCluster), clusterList, boundingBoxVector, closestDistance);
 
     return closestDistance;
 }
@@ -307,6 +306,12 @@ CartesianVector LArClusterHelper::GetClosestPosition(const CartesianVector &posi
 void LArClusterHelper::GetClosestPositions(
     const Cluster *const pCluster1, const Cluster *const pCluster2, CartesianVector &outputPosition1, CartesianVector &outputPosition2)
 {
+    // ATTN Indexing the second cluster only pays off once the number of hit pairs is large enough to amortise the cost of building it
+    const unsigned int minHitPairsForIndex(256);
+
+    if (pCluster1->GetNCaloHits() * pCluster2->GetNCaloHits() >= minHitPairsForIndex)
+        return LArClusterHelper::GetClosestPositionsIndexed(pCluster1, pCluster2, outputPosition1, outputPosition2);
+
     bool distanceFound(false);
     float minDistanceSquared(std::numeric_limits<float>::max());
 
@@ -353,6 +358,60 @@ void LArClusterHelper::GetClosestPositions(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArClusterHelper::GetClosestPositionsIndexed(
+    const Cluster *const pCluster1, const Cluster *const pCluster2, CartesianVector &outputPosition1, CartesianVector &outputPosition2)
+{
+    const HitPositionIndex hitPositionIndex2(pCluster2);
+    const BoundingBox boundingBox2(pCluster2);
+
+    float minDistanceSquared(std::numeric_limits<float>::max());
+    const CartesianVector *pClosestPosition1(nullptr), *pClosestPosition2(nullptr);
+
+    // ATTN Hits in cluster 1 are visited in the same order as the brute-force search, so that ties are resolved identically
+    for (const auto &entry : pCluster1->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit1 : *entry.second)
+        {
+            const CartesianVector &positionVector1(pCaloHit1->GetPositionVector());
+
+            if (BoundingBox(positionVector1).GetDistanceSquared(boundingBox2) >= minDistanceSquared)
+                continue;
+
+            if (hitPositionIndex2.FindClosestHit(positionVector1, minDistanceSquared, pClosestPosition2))
+                pClosestPosition1 = &positionVector1;
+        }
+    }
+
+    if (!pClosestPosition1 || !pClosestPosition2)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    outputPosition1 = *pClosestPosition1;
+    outputPosition2 = *pClosestPosition2;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArClusterHelper::UpdateClosestDistance(const Cluster *const pCluster, const BoundingBox &boundingBox, const ClusterList &clusterList,
+    const BoundingBoxVector &boundingBoxVector, float &closestDistance)
+{
+    BoundingBoxVector::const_iterator boxIter(boundingBoxVector.begin());
+
+    for (ClusterList::const_iterator iter = clusterList.begin(), iterEnd = clusterList.end(); iter != iterEnd; ++iter, ++boxIter)
+    {
+        // ATTN Empty clusters are never skipped, so that the exception raised by the full calculation is preserved
+        if (!boundingBox.m_isEmpty && !boxIter->m_isEmpty && (std::sqrt(boundingBox.GetDistanceSquared(*boxIter)) >= closestDistance))
+            continue;
+
+        const Cluster *const pTestCluster = *iter;
+        const float thisDistance(LArClusterHelper::GetClosestDistance(pCluster, pTestCluster));
+
+        if (thisDistance < closestDistance)
+            closestDistance = thisDistance;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void LArClusterHelper::GetClusterBoundingBox(const Cluster *const pCluster, CartesianVector &minimumCoordinate, CartesianVector &maximumCoordinate)
 {
     const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
@@ -781,4 +840,110 @@ bool LArClusterHelper::SortCoordinatesByPosition(const CartesianVector &lhs, con
     return (deltaPosition.GetY() > std::numeric_limits<float>::epsilon());
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::BoundingBox::BoundingBox(const Cluster *const pCluster) :
+    m_minimum(0.f, 0.f, 0.f),
+    m_maximum(0.f, 0.f, 0.f),
+    m_isEmpty(pCluster->GetOrderedCaloHitList().empty())
+{
+    LArClusterHelper::GetClusterBoundingBox(pCluster, m_minimum, m_maximum);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::BoundingBox::BoundingBox(const CartesianVector &position) :
+    m_minimum(position),
+    m_maximum(position),
+    m_isEmpty(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArClusterHelper::BoundingBox::GetDistanceSquared(const BoundingBox &other) const
+{
+    // ATTN Floating point rounding is monotonic, so these separations never exceed those calculated for any pair of contained positions
+    const float deltaX(std::max(0.f, std::max(other.m_minimum.GetX() - m_maximum.GetX(), m_minimum.GetX() - other.m_maximum.GetX())));
+    const float deltaY(std::max(0.f, std::max(other.m_minimum.GetY() - m_maximum.GetY(), m_minimum.GetY() - other.m_maximum.GetY())));
+    const float deltaZ(std::max(0.f, std::max(other.m_minimum.GetZ() - m_maximum.GetZ(), m_minimum.GetZ() - other.m_maximum.GetZ())));
+
+    return (deltaX * deltaX + deltaY * deltaY + deltaZ * deltaZ);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::HitPositionIndex::HitPositionIndex(const Cluster *const pCluster)
+{
+    m_entries.reserve(pCluster->GetNCaloHits());
+
+    for (const auto &entry : pCluster->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit : *entry.second)
+        {
+            const CartesianVector &position(pCaloHit->GetPositionVector());
+            m_entries.push_back(Entry{position.GetX(), static_cast<unsigned int>(m_entries.size()), &position});
+        }
+    }
+
+    std::stable_sort(m_entries.begin(), m_entries.end(), [](const Entry &lhs, const Entry &rhs) { return (lhs.m_x < rhs.m_x); });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArClusterHelper::HitPositionIndex::FindClosestHit(
+    const CartesianVector &position, float &closestDistanceSquared, const CartesianVector *&pClosestPosition) const
+{
+    const float x(position.GetX());
+    float bestDistanceSquared(closestDistanceSquared);
+    unsigned int bestIndex(std::numeric_limits<unsigned int>::max());
+    const CartesianVector *pBestPosition(nullptr);
+
+    // ATTN Hits must be strictly closer than the current best, with equidistant hits resolved by their ordered calo hit list index
+    const auto considerEntry = [&](const Entry &entry)
+    {
+        const float distanceSquared((position - *entry.m_pPosition).GetMagnitudeSquared());
+
+        if ((distanceSquared < bestDistanceSquared) || (pBestPosition && (distanceSquared == bestDistanceSquared) && (entry.m_index < bestIndex)))
+        {
+            bestDistanceSquared = distanceSquared;
+            bestIndex = entry.m_index;
+            pBestPosition = entry.m_pPosition;
+        }
+    };
+
+    const EntryVector::const_iterator startIter(
+        std::lower_bound(m_entries.begin(), m_entries.end(), x, [](const Entry &entry, const float value) { return (entry.m_x < value); }));
+
+    for (EntryVector::const_iterator iter = startIter; iter != m_entries.end(); ++iter)
+    {
+        const float deltaX(iter->m_x - x);
+
+        if (deltaX * deltaX > bestDistanceSquared)
+            break;
+
+        considerEntry(*iter);
+    }
+
+    for (EntryVector::const_iterator iter = startIter; iter != m_entries.begin();)
+    {
+        --iter;
+        const float deltaX(x - iter->m_x);
+
+        if (deltaX * deltaX > bestDistanceSquared)
+            break;
+
+        considerEntry(*iter);
+    }
+
+    if (!pBestPosition)
+        return false;
+
+    closestDistanceSquared = bestDistanceSquared;
+    pClosestPosition = pBestPosition;
+    return true;
+}
+
 } // namespace lar_content
@@ -384,6 +384,110 @@ public:
      *  @param  rhs second point
      */
     static bool SortCoordinatesByPosition(const pandora::CartesianVector &lhs, const pandora::CartesianVector &rhs);
+
+private:
+    /**
+     *  @brief  BoundingBox class
+     */
+    class BoundingBox
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster address of the cluster
+         */
+        BoundingBox(const pandora::Cluster *const pCluster);
+
+        /**
+         *  @brief  Constructor, for a bounding box enclosing a single position
+         *
+         *  @param  position the position vector
+         */
+        BoundingBox(const pandora::CartesianVector &position);
+
+        /**
+         *  @brief  Get a lower bound on the squared distance between any pair of positions contained in this and another bounding box
+         *
+         *  @param  other the other bounding box
+         *
+         *  @return the lower bound on the squared distance
+         */
+        float GetDistanceSquared(const BoundingBox &other) const;
+
+        pandora::CartesianVector m_minimum; ///< The minimum coordinate
+        pandora::CartesianVector m_maximum; ///< The maximum coordinate
+        bool m_isEmpty;                     ///< Whether the cluster has no hits
+    };
+
+    typedef std::vector<BoundingBox> BoundingBoxVector;
+
+    /**
+     *  @brief  HitPositionIndex class, the hit positions of a cluster sorted in x, allowing pruned searches for the closest hit
+     */
+    class HitPositionIndex
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster address of the cluster
+         */
+        HitPositionIndex(const pandora::Cluster *const pCluster);
+
+        /**
+         *  @brief  Find the hit closest to a specified position, considering only hits strictly closer than a current best distance. Where
+         *          several hits are equidistant, the first in ordered calo hit list order is returned, matching the brute-force search
+         *
+         *  @param  position the position vector
+         *  @param  closestDistanceSquared the current best squared distance, updated if a closer hit is found
+         *  @param  pClosestPosition to receive the address of the closest hit position, if a closer hit is found
+         *
+         *  @return whether a closer hit was found
+         */
+        bool FindClosestHit(
+            const pandora::CartesianVector &position, float &closestDistanceSquared, const pandora::CartesianVector *&pClosestPosition) const;
+
+    private:
+        /**
+         *  @brief  Entry class
+         */
+        class Entry
+        {
+        public:
+            float m_x;                                   ///< The hit x coordinate
+            unsigned int m_index;                        ///< The hit index in ordered calo hit list order
+            const pandora::CartesianVector *m_pPosition; ///< The address of the hit position
+        };
+
+        typedef std::vector<Entry> EntryVector;
+
+        EntryVector m_entries; ///< The entries, sorted by x coordinate and then by index
+    };
+
+    /**
+     *  @brief  Get pair of closest positions for a pair of clusters, using an index of the hit positions in the second cluster
+     *
+     *  @param  pCluster1 the address of the first cluster
+     *  @param  pCluster2 the address of the second cluster
+     *  @param  the closest position in the first cluster
+     *  @param  the closest position in the second cluster
+     */
+    static void GetClosestPositionsIndexed(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2,
+        pandora::CartesianVector &position1, pandora::CartesianVector &position2);
+
+    /**
+     *  @brief  Update the closest distance between a specified cluster and list of clusters, skipping clusters whose bounding boxes
+     *          cannot contain a closer pair of hits
+     *
+     *  @param  pCluster address of the input cluster
+     *  @param  boundingBox the bounding box of the input cluster
+     *  @param  clusterList list of input clusters
+     *  @param  boundingBoxVector the bounding boxes of the input clusters, in cluster list order
+     *  @param  closestDistance the closest distance, updated if a closer pair of hits is found
+     */
+    static void UpdateClosestDistance(const pandora::Cluster *const pCluster, const BoundingBox &boundingBox, const pandora::ClusterList &clusterList,
+        const BoundingBoxVector &boundingBoxVector, float &closestDistance);
 };
 
 } // namespace lar_content
@@ -1310,28 +1310,41 @@ void LArHierarchyHelper::MatchInfo::Match()
     PfoList rootPfos;
     m_recoHierarchy.GetRootPfos(rootPfos);
     std::map<const MCHierarchy::Node *, MCMatches> mcToMatchMap;
+    std::unordered_map<const MCHierarchy::Node *, const MCParticle *> mcNodeToRootMap;
 
     for (const MCParticle *const pRootMC : rootMCParticles)
     {
         MCHierarchy::NodeVector mcNodes;
         m_mcHierarchy.GetFlattenedNodes(pRootMC, mcNodes);
-
-        // Get all of the hits from the MC nodes (for selecting reco hits)
-        CaloHitList allMCHits;
-        for (const MCHierarchy::Node *pMCNode : mcNodes)
+        std::sort(mcNodes.begin(), mcNodes.end(),
+            [](const MCHierarchy::Node *lhs, const MCHierarchy::Node *rhs)
+            { return lhs->GetCaloHits().size() > rhs->GetCaloHits().size(); });
+
+        // Index the hits of the MC nodes once, both by parent address (for selecting reco hits) and by the reconstructable nodes to
+        // which they belong (for counting shared hits), so each reco node can be matched with a single pass over its own hits
+        ParentAddressSet mcParentAddresses;
+        CaloHitToNodeIndicesMap hitToNodeIndicesMap;
+        for (size_t n = 0; n < mcNodes.size(); ++n)
         {
-            const CaloHitList &mcHits{pMCNode->GetCaloHits()};
-            allMCHits.insert(allMCHits.begin(), mcHits.begin(), mcHits.end());
+            const MCHierarchy::Node *const pMCNode{mcNodes[n]};
+            mcNodeToRootMap.insert(std::make_pair(pMCNode, pRootMC));
+
+            for (const CaloHit *const pCaloHit : pMCNode->GetCaloHits())
+            {
+                if (m_qualityCuts.m_selectRecoHits)
+                    mcParentAddresses.insert(pCaloHit->GetParentAddress());
+
+                if (pMCNode->IsReconstructable())
+                    hitToNodeIndicesMap[pCaloHit].emplace_back(n);
+            }
         }
 
+        std::vector<size_t> sharedHitCounts(mcNodes.size(), 0);
+
         for (const ParticleFlowObject *const pRootPfo : rootPfos)
         {
             RecoHierarchy::NodeVector recoNodes;
             m_recoHierarchy.GetFlattenedNodes(pRootPfo, recoNodes);
-
-            std::sort(mcNodes.begin(), mcNodes.end(),
-                [](const MCHierarchy::Node *lhs, const MCHierarchy::Node *rhs)
-                { return lhs->GetCaloHits().size() > rhs->GetCaloHits().size(); });
             std::sort(recoNodes.begin(), recoNodes.end(),
                 [](const RecoHierarchy::Node *lhs, const RecoHierarchy::Node *rhs)
                 { return lhs->GetCaloHits().size() > rhs->GetCaloHits().size(); });
@@ -1341,30 +1354,13 @@ void LArHierarchyHelper::MatchInfo::Match()
                 // Get the selected list of reco hits that overlap with all of the MC hits
                 // or just use all of the hits in the reco node
                 const CaloHitList selectedRecoHits = (m_qualityCuts.m_selectRecoHits == true)
-                    ? LArHierarchyHelper::MatchInfo::GetSelectedRecoHits(pRecoNode, allMCHits)
+                    ? LArHierarchyHelper::MatchInfo::GetSelectedRecoHits(pRecoNode, mcParentAddresses)
                     : pRecoNode->GetCaloHits();
 
-                const MCHierarchy::Node *pBestNode{nullptr};
                 size_t bestSharedHits{0};
-                for (const MCHierarchy::Node *pMCNode : mcNodes)
-                {
-                    if (!pMCNode->IsReconstructable())
-                        continue;
-                    const CaloHitList &mcHits{pMCNode->GetCaloHits()};
-                    CaloHitVector intersection;
-                    std::set_intersection(
-                        mcHits.begin(), mcHits.end(), selectedRecoHits.begin(), selectedRecoHits.end(), std::back_inserter(intersection));
-
-                    if (!intersection.empty())
-                    {
-                        const size_t sharedHits{intersection.size()};
-                        if (sharedHits > bestSharedHits)
-                        {
-                            bestSharedHits = sharedHits;
-                            pBestNode = pMCNode;
-                        }
-                    }
-                }
+                const MCHierarchy::Node *const pBestNode{
+                    this->GetBestMCNode(mcNodes, hitToNodeIndicesMap, selectedRecoHits, sharedHitCounts, bestSharedHits)};
+
                 if (pBestNode)
                 {
                     auto iter{mcToMatchMap.find(pBestNode)};
@@ -1391,16 +1387,9 @@ void LArHierarchyHelper::MatchInfo::Match()
     for (auto [pMCNode, matches] : mcToMatchMap)
     {
         // We need to figure out which MC interaction hierarchy the matches belongs to
-        for (const MCParticle *const pRootMC : rootMCParticles)
-        {
-            MCHierarchy::NodeVector mcNodes;
-            m_mcHierarchy.GetFlattenedNodes(pRootMC, mcNodes);
-            if (std::find(mcNodes.begin(), mcNodes.end(), pMCNode) != mcNodes.end())
-            {
-                m_matches[pRootMC].emplace_back(matches);
-                break;
-            }
-        }
+        auto iter{mcNodeToRootMap.find(pMCNode)};
+        if (iter != mcNodeToRootMap.end())
+            m_matches[iter->second].emplace_back(matches);
     }
 
     const auto predicate = [](const MCMatches &lhs, const MCMatches &rhs)
@@ -1492,23 +1481,26 @@ unsigned int LArHierarchyHelper::MatchInfo::GetNTestBeamMCNodes(const MCParticle
 
 const CaloHitList LArHierarchyHelper::MatchInfo::GetSelectedRecoHits(const RecoHierarchy::Node *pRecoNode, const CaloHitList &allMCHits) const
 {
-    // Select all of the reco node hit Ids that overlap with the allMCHits Ids
+    ParentAddressSet mcParentAddresses;
+    for (const CaloHit *pMCHit : allMCHits)
+        mcParentAddresses.insert(pMCHit->GetParentAddress());
+
+    return this->GetSelectedRecoHits(pRecoNode, mcParentAddresses);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const CaloHitList LArHierarchyHelper::MatchInfo::GetSelectedRecoHits(
+    const RecoHierarchy::Node *pRecoNode, const ParentAddressSet &mcParentAddresses) const
+{
+    // Select all of the reco node hits whose parent addresses match those of the MC hits
     CaloHitList selectedHits;
     if (pRecoNode)
     {
-        const CaloHitList recoHits{pRecoNode->GetCaloHits()};
-        for (const CaloHit *pRecoHit : recoHits)
+        for (const CaloHit *pRecoHit : pRecoNode->GetCaloHits())
         {
-            const int recoId = reinterpret_cast<intptr_t>(pRecoHit->GetParentAddress());
-            for (const CaloHit *pMCHit : allMCHits)
-            {
-                const int mcId = reinterpret_cast<intptr_t>(pMCHit->GetParentAddress());
-                if (recoId == mcId)
-                {
-                    selectedHits.emplace_back(pRecoHit);
-                    break;
-                }
-            }
+            if (mcParentAddresses.count(pRecoHit->GetParentAddress()))
+                selectedHits.emplace_back(pRecoHit);
         }
     }
     return selectedHits;
@@ -1516,6 +1508,38 @@ const CaloHitList LArHierarchyHelper::MatchInfo::GetSelectedRecoHits(const RecoH
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+const LArHierarchyHelper::MCHierarchy::Node *LArHierarchyHelper::MatchInfo::GetBestMCNode(const MCHierarchy::NodeVector &mcNodes,
+    const CaloHitToNodeIndicesMap &hitToNodeIndicesMap, const CaloHitList &recoHits, std::vector<size_t> &sharedHitCounts,
+    size_t &bestSharedHits) const
+{
+    std::fill(sharedHitCounts.begin(), sharedHitCounts.end(), 0);
+
+    for (const CaloHit *pRecoHit : recoHits)
+    {
+        auto iter{hitToNodeIndicesMap.find(pRecoHit)};
+        if (iter == hitToNodeIndicesMap.end())
+            continue;
+
+        for (const size_t n : iter->second)
+            ++sharedHitCounts.at(n);
+    }
+
+    const MCHierarchy::Node *pBestNode{nullptr};
+    bestSharedHits = 0;
+    for (size_t n = 0; n < mcNodes.size(); ++n)
+    {
+        if (sharedHitCounts.at(n) > bestSharedHits)
+        {
+            bestSharedHits = sharedHitCounts.at(n);
+            pBestNode = mcNodes.at(n);
+        }
+    }
+
+    return pBestNode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void LArHierarchyHelper::MatchInfo::Print(const MCHierarchy &mcHierarchy) const
 {
     MCParticleList rootMCParticles;
@@ -15,6 +15,10 @@
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 namespace lar_content
 {
 
@@ -872,6 +876,35 @@ public:
         void Print(const MCHierarchy &mcHierarchy) const;
 
     private:
+        typedef std::unordered_set<const void *> ParentAddressSet;
+        typedef std::unordered_map<const pandora::CaloHit *, std::vector<size_t>> CaloHitToNodeIndicesMap;
+
+        /**
+         *  @brief  Get the selected reco node hits whose parent addresses are contained in the provided set
+         *
+         *  @param  pRecoNode The reco node pointer
+         *  @param  mcParentAddresses The set of parent addresses of all of the MC hits that will be used for the selection
+         *
+         *  @return The selected reco calo hits
+         */
+        const pandora::CaloHitList GetSelectedRecoHits(
+            const RecoHierarchy::Node *pRecoNode, const ParentAddressSet &mcParentAddresses) const;
+
+        /**
+         *  @brief  Find the reconstructable MC node sharing the most hits with a list of reco hits, using an index from each hit to the
+         *          MC nodes containing it. Ties are resolved in favour of the node appearing first in the MC node vector
+         *
+         *  @param  mcNodes The MC nodes that may be matched
+         *  @param  hitToNodeIndicesMap The map from each hit in a reconstructable MC node to the indices of the MC nodes containing it
+         *  @param  recoHits The reco hits to match
+         *  @param  sharedHitCounts Scratch space for the per node shared hit counts
+         *  @param  bestSharedHits To receive the number of hits shared with the best node
+         *
+         *  @return The best matched MC node, nullptr if no hits are shared
+         */
+        const MCHierarchy::Node *GetBestMCNode(const MCHierarchy::NodeVector &mcNodes, const CaloHitToNodeIndicesMap &hitToNodeIndicesMap,
+            const pandora::CaloHitList &recoHits, std::vector<size_t> &sharedHitCounts, size_t &bestSharedHits) const;
+
         const MCHierarchy &m_mcHierarchy;          ///< The MC hierarchy for the matching procedure
         const RecoHierarchy &m_recoHierarchy;      ///< The Reco hierarchy for the matching procedure
         InteractionInfo m_matches;                 ///< The map between an interaction and the vector of good matches from MC to reco
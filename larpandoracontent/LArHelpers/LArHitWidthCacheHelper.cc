@@ -0,0 +1,51 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArHitWidthCacheHelper.cc
+ *
+ *  @brief  Implementation of the hit width cache helper class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/Pandora.h"
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArHelpers/LArHitWidthCacheHelper.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+const LArHitWidthHelper::ClusterParameters &LArHitWidthCacheHelper::GetClusterParameters(const Pandora &pandora,
+    const Cluster *const pCluster, const float maxConstituentHitWidth, const bool isUniformHits, const float hitWidthScalingFactor)
+{
+    return HitWidthCache::GetResult(pandora, pCluster, HitWidthKey(maxConstituentHitWidth, isUniformHits, hitWidthScalingFactor),
+        [&]()
+        {
+            return std::unique_ptr<const LArHitWidthHelper::ClusterParameters>(
+                new LArHitWidthHelper::ClusterParameters(pCluster, maxConstituentHitWidth, isUniformHits, hitWidthScalingFactor));
+        });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArHitWidthCacheHelper::Reset(const Pandora &pandora)
+{
+    HitWidthCache::Reset(pandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArHitWidthCacheHelper::Erase(const Pandora &pandora)
+{
+    HitWidthCache::Erase(pandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArHitWidthCacheHelper::CacheStatistics LArHitWidthCacheHelper::GetStatistics(const Pandora &pandora)
+{
+    return HitWidthCache::GetStatistics(pandora);
+}
+
+} // namespace lar_content
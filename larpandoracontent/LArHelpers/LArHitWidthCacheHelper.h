@@ -0,0 +1,79 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArHitWidthCacheHelper.h
+ *
+ *  @brief  Header file for the hit width cache helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_HIT_WIDTH_CACHE_HELPER_H
+#define LAR_HIT_WIDTH_CACHE_HELPER_H 1
+
+#include "larpandoracontent/LArHelpers/LArClusterCacheHelper.h"
+#include "larpandoracontent/LArHelpers/LArHitWidthHelper.h"
+
+#include <tuple>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArHitWidthCacheHelper class, providing an event-scoped cache of the constituent hit decomposition of clusters, shared by all
+ *          algorithms that opt in within a pandora instance. Results are keyed by cluster, maximum constituent hit width, uniform flag
+ *          and hit width scaling factor.
+ */
+class LArHitWidthCacheHelper
+{
+public:
+    typedef std::tuple<float, bool, float> HitWidthKey; ///< The maximum constituent hit width, uniform flag and hit width scaling factor
+    typedef LArClusterCacheHelper<HitWidthKey, LArHitWidthHelper::ClusterParameters> HitWidthCache;
+    typedef HitWidthCache::CacheStatistics CacheStatistics;
+
+    /**
+     *  @brief  Get the cluster parameters, holding the constituent hits, their total weight and their x extremal points, for a cluster
+     *          from the cache for the pandora instance, performing and caching the decomposition if required. The returned reference
+     *          remains valid until the cache is reset, or until a request for the same cluster and decomposition settings finds that the
+     *          cluster has been modified. Callers should therefore copy the result if it is to be kept.
+     *
+     *  @param  pandora the pandora instance
+     *  @param  pCluster address of the cluster
+     *  @param  maxConstituentHitWidth the maximum width of a constituent hit
+     *  @param  isUniformHits whether to break up the hits into uniform constituent hits (and pad the hits) or not
+     *  @param  hitWidthScalingFactor the constituent hit width scaling factor
+     *
+     *  @return the cluster parameters
+     *
+     *  @throw  StatusCodeException, as for the ClusterParameters constructor (failed decompositions are not cached)
+     */
+    static const LArHitWidthHelper::ClusterParameters &GetClusterParameters(const pandora::Pandora &pandora,
+        const pandora::Cluster *const pCluster, const float maxConstituentHitWidth, const bool isUniformHits,
+        const float hitWidthScalingFactor);
+
+    /**
+     *  @brief  Reset the cache for a pandora instance, discarding all results and statistics. To be called from the Reset method of
+     *          each algorithm using the cache
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void Reset(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Erase the cache for a pandora instance, releasing all memory. To be called from the destructor of each algorithm using
+     *          the cache
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void Erase(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Get the cache statistics for a pandora instance, accumulated since the last reset
+     *
+     *  @param  pandora the pandora instance
+     *
+     *  @return the cache statistics
+     */
+    static CacheStatistics GetStatistics(const pandora::Pandora &pandora);
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_HIT_WIDTH_CACHE_HELPER_H
@@ -963,10 +963,11 @@ bool LArMCParticleHelper::IsPairProduction(const MCParticle *const pMCParticle)
 CaloHitList LArMCParticleHelper::GetSharedHits(const CaloHitList &hitListA, const CaloHitList &hitListB)
 {
     CaloHitList sharedHits;
+    const CaloHitSet hitSetB(hitListB.begin(), hitListB.end());
 
     for (const CaloHit *const pCaloHit : hitListA)
     {
-        if (std::find(hitListB.begin(), hitListB.end(), pCaloHit) != hitListB.end())
+        if (hitSetB.count(pCaloHit))
             sharedHits.push_back(pCaloHit);
     }
 
@@ -195,6 +195,17 @@ public:
     template <typename T, typename... Ts, typename... TARGS>
     static MvaFeatureVector CalculateFeaturesOfType(const MvaFeatureToolVector<Ts...> &featureToolVector, TARGS &&...args);
 
+    /**
+     *  @brief  Get the feature tools of a given derived feature tool type in a feature tool vector, preserving their order, so that typed
+     *          lookups can be resolved once rather than for every feature calculation
+     *
+     *  @param  featureToolVector the feature tool vector
+     *
+     *  @return the vector of feature tools of the given type
+     */
+    template <typename T, typename... Ts>
+    static MvaFeatureToolVector<Ts...> GetFeatureToolsOfType(const MvaFeatureToolVector<Ts...> &featureToolVector);
+
     /**
      *  @brief  Add a feature tool to a vector of feature tools
      *
@@ -447,6 +458,23 @@ LArMvaHelper::MvaFeatureVector LArMvaHelper::CalculateFeaturesOfType(const MvaFe
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T, typename... Ts>
+MvaFeatureToolVector<Ts...> LArMvaHelper::GetFeatureToolsOfType(const MvaFeatureToolVector<Ts...> &featureToolVector)
+{
+    using TD = typename std::decay<T>::type;
+    MvaFeatureToolVector<Ts...> typedFeatureToolVector;
+
+    for (MvaFeatureTool<Ts...> *const pFeatureTool : featureToolVector)
+    {
+        if (dynamic_cast<TD *const>(pFeatureTool))
+            typedFeatureToolVector.push_back(pFeatureTool);
+    }
+
+    return typedFeatureToolVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename... Ts>
 pandora::StatusCode LArMvaHelper::AddFeatureToolToVector(pandora::AlgorithmTool *const pFeatureTool, MvaFeatureToolVector<Ts...> &featureToolVector)
 {
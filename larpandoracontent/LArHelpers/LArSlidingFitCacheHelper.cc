@@ -0,0 +1,47 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.cc
+ *
+ *  @brief  Implementation of the sliding fit cache helper class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/Pandora.h"
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+const TwoDSlidingFitResult &LArSlidingFitCacheHelper::GetSlidingFitResult(
+    const Pandora &pandora, const Cluster *const pCluster, const unsigned int layerFitHalfWindow, const float layerPitch)
+{
+    return SlidingFitCache::GetResult(pandora, pCluster, SlidingFitKey(layerFitHalfWindow, layerPitch),
+        [&]() { return std::unique_ptr<const TwoDSlidingFitResult>(new TwoDSlidingFitResult(pCluster, layerFitHalfWindow, layerPitch)); });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArSlidingFitCacheHelper::Reset(const Pandora &pandora)
+{
+    SlidingFitCache::Reset(pandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArSlidingFitCacheHelper::Erase(const Pandora &pandora)
+{
+    SlidingFitCache::Erase(pandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArSlidingFitCacheHelper::CacheStatistics LArSlidingFitCacheHelper::GetStatistics(const Pandora &pandora)
+{
+    return SlidingFitCache::GetStatistics(pandora);
+}
+
+} // namespace lar_content
@@ -0,0 +1,76 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h
+ *
+ *  @brief  Header file for the sliding fit cache helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_SLIDING_FIT_CACHE_HELPER_H
+#define LAR_SLIDING_FIT_CACHE_HELPER_H 1
+
+#include "larpandoracontent/LArHelpers/LArClusterCacheHelper.h"
+
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
+
+#include <utility>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArSlidingFitCacheHelper class, providing an event-scoped cache of two dimensional cluster sliding fit results, shared by all
+ *          algorithms that opt in within a pandora instance. Results are keyed by cluster, layer fit half window and layer pitch.
+ */
+class LArSlidingFitCacheHelper
+{
+public:
+    typedef std::pair<unsigned int, float> SlidingFitKey; ///< The layer fit half window and layer pitch
+    typedef LArClusterCacheHelper<SlidingFitKey, TwoDSlidingFitResult> SlidingFitCache;
+    typedef SlidingFitCache::CacheStatistics CacheStatistics;
+
+    /**
+     *  @brief  Get the sliding fit result for a cluster from the cache for the pandora instance, performing and caching the fit if
+     *          required. The returned reference remains valid until the cache is reset, or until a request for the same cluster, half
+     *          window and pitch finds that the cluster has been modified. Callers should therefore copy the result if it is to be kept.
+     *
+     *  @param  pandora the pandora instance
+     *  @param  pCluster address of the cluster
+     *  @param  layerFitHalfWindow the layer fit half window
+     *  @param  layerPitch the layer pitch, units cm
+     *
+     *  @return the sliding fit result
+     *
+     *  @throw  StatusCodeException, as for the TwoDSlidingFitResult constructor (failed fits are not cached)
+     */
+    static const TwoDSlidingFitResult &GetSlidingFitResult(const pandora::Pandora &pandora, const pandora::Cluster *const pCluster,
+        const unsigned int layerFitHalfWindow, const float layerPitch);
+
+    /**
+     *  @brief  Reset the cache for a pandora instance, discarding all results and statistics. To be called from the Reset method of
+     *          each algorithm using the cache
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void Reset(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Erase the cache for a pandora instance, releasing all memory. To be called from the destructor of each algorithm using
+     *          the cache
+     *
+     *  @param  pandora the pandora instance
+     */
+    static void Erase(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Get the cache statistics for a pandora instance, accumulated since the last reset
+     *
+     *  @param  pandora the pandora instance
+     *
+     *  @return the cache statistics
+     */
+    static CacheStatistics GetStatistics(const pandora::Pandora &pandora);
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_SLIDING_FIT_CACHE_HELPER_H
@@ -0,0 +1,21 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArThreadingHelper.cc
+ *
+ *  @brief  Implementation of the threading helper class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
+
+namespace lar_content
+{
+
+unsigned int LArThreadingHelper::GetNThreads(const unsigned int nRequestedThreads, const unsigned int nTasks)
+{
+    const unsigned int nThreads((0 == nRequestedThreads) ? std::thread::hardware_concurrency() : nRequestedThreads);
+
+    return std::max(1u, std::min(nThreads, nTasks));
+}
+
+} // namespace lar_content
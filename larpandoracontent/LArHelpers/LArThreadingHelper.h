@@ -0,0 +1,101 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArThreadingHelper.h
+ *
+ *  @brief  Header file for the threading helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_THREADING_HELPER_H
+#define LAR_THREADING_HELPER_H 1
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArThreadingHelper class
+ */
+class LArThreadingHelper
+{
+public:
+    /**
+     *  @brief  Get the number of threads to use for a given number of independent tasks
+     *
+     *  @param  nRequestedThreads the requested number of threads (zero to use the number of available hardware threads)
+     *  @param  nTasks the number of tasks to be processed
+     *
+     *  @return the number of threads, at least one and at most the number of tasks
+     */
+    static unsigned int GetNThreads(const unsigned int nRequestedThreads, const unsigned int nTasks);
+
+    /**
+     *  @brief  Process a number of independent tasks using a pool of threads, each thread taking the next task index from a shared work
+     *          queue until all tasks are exhausted. Functor is called as task(threadIndex, taskIndex), with threadIndex in [0, nThreads) and
+     *          identifying the calling thread, so that per-thread resources can be used without locking. Any exception raised by a task is
+     *          caught and, once all threads have joined, the exception raised by the lowest-index failing task is rethrown.
+     *
+     *  @param  nThreads the number of threads (a value of one processes all tasks in order in the calling thread)
+     *  @param  nTasks the number of tasks
+     *  @param  task the task functor
+     */
+    template <typename TASK>
+    static void RunTasks(const unsigned int nThreads, const unsigned int nTasks, const TASK &task);
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename TASK>
+void LArThreadingHelper::RunTasks(const unsigned int nThreads, const unsigned int nTasks, const TASK &task)
+{
+    if ((nThreads <= 1) || (nTasks <= 1))
+    {
+        for (unsigned int taskIndex = 0; taskIndex < nTasks; ++taskIndex)
+            task(0, taskIndex);
+
+        return;
+    }
+
+    std::atomic<unsigned int> nextTaskIndex(0);
+    std::vector<std::exception_ptr> taskExceptions(nTasks);
+
+    const auto threadFunction = [&](const unsigned int threadIndex)
+    {
+        for (unsigned int taskIndex = nextTaskIndex++; taskIndex < nTasks; taskIndex = nextTaskIndex++)
+        {
+            try
+            {
+                task(threadIndex, taskIndex);
+            }
+            catch (...)
+            {
+                taskExceptions.at(taskIndex) = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(nThreads - 1);
+
+    for (unsigned int threadIndex = 1; threadIndex < std::min(nThreads, nTasks); ++threadIndex)
+        threads.emplace_back(threadFunction, threadIndex);
+
+    threadFunction(0);
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    for (const std::exception_ptr &pException : taskExceptions)
+    {
+        if (pException)
+            std::rethrow_exception(pException);
+    }
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_THREADING_HELPER_H
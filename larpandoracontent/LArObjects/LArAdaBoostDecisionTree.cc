@@ -140,6 +140,29 @@ double AdaBoostDecisionTree::CalculateProbability(const LArMvaHelper::MvaFeature
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void AdaBoostDecisionTree::CalculateClassificationScores(const MvaTypes::MvaFeatureVectorVector &featuresVector,
+    std::vector<double> &scores) const
+{
+    this->CalculateScores(featuresVector, scores);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AdaBoostDecisionTree::CalculateProbabilities(const MvaTypes::MvaFeatureVectorVector &featuresVector,
+    std::vector<double> &probabilities) const
+{
+    std::vector<double> scores;
+    this->CalculateScores(featuresVector, scores);
+
+    // ATTN: See CalculateProbability for the mapping of the score to the range 0 to 1
+    probabilities.reserve(probabilities.size() + scores.size());
+
+    for (const double score : scores)
+        probabilities.emplace_back((score + 1.) * 0.5);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 double AdaBoostDecisionTree::CalculateScore(const LArMvaHelper::MvaFeatureVector &features) const
 {
     if (!m_pStrongClassifier)
@@ -155,28 +178,55 @@ double AdaBoostDecisionTree::CalculateScore(const LArMvaHelper::MvaFeatureVector
     }
     catch (StatusCodeException &statusCodeException)
     {
-        if (STATUS_CODE_NOT_FOUND == statusCodeException.GetStatusCode())
-        {
-            std::cout << "AdaBoostDecisionTree: Caught exception thrown when trying to cut on an unknown variable." << std::endl;
-        }
-        else if (STATUS_CODE_INVALID_PARAMETER == statusCodeException.GetStatusCode())
-        {
-            std::cout << "AdaBoostDecisionTree: Caught exception thrown when classifier weights sum to zero indicating defunct classifier."
-                      << std::endl;
-        }
-        else if (STATUS_CODE_OUT_OF_RANGE == statusCodeException.GetStatusCode())
-        {
-            std::cout << "AdaBoostDecisionTree: Caught exception thrown when heirarchy in decision tree is incomplete." << std::endl;
-        }
-        else
-        {
-            std::cout << "AdaBoostDecisionTree: Unexpected exception thrown." << std::endl;
-        }
+        this->ReportScoreException(statusCodeException);
+        throw statusCodeException;
+    }
+}
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AdaBoostDecisionTree::CalculateScores(const MvaTypes::MvaFeatureVectorVector &featuresVector, std::vector<double> &scores) const
+{
+    if (!m_pStrongClassifier)
+    {
+        std::cout << "AdaBoostDecisionTree: Attempting to use an uninitialized bdt" << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+    }
+
+    try
+    {
+        m_pStrongClassifier->Predict(featuresVector, scores);
+    }
+    catch (StatusCodeException &statusCodeException)
+    {
+        this->ReportScoreException(statusCodeException);
         throw statusCodeException;
     }
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AdaBoostDecisionTree::ReportScoreException(const StatusCodeException &statusCodeException) const
+{
+    if (STATUS_CODE_NOT_FOUND == statusCodeException.GetStatusCode())
+    {
+        std::cout << "AdaBoostDecisionTree: Caught exception thrown when trying to cut on an unknown variable." << std::endl;
+    }
+    else if (STATUS_CODE_INVALID_PARAMETER == statusCodeException.GetStatusCode())
+    {
+        std::cout << "AdaBoostDecisionTree: Caught exception thrown when classifier weights sum to zero indicating defunct classifier."
+                  << std::endl;
+    }
+    else if (STATUS_CODE_OUT_OF_RANGE == statusCodeException.GetStatusCode())
+    {
+        std::cout << "AdaBoostDecisionTree: Caught exception thrown when heirarchy in decision tree is incomplete." << std::endl;
+    }
+    else
+    {
+        std::cout << "AdaBoostDecisionTree: Unexpected exception thrown." << std::endl;
+    }
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -326,47 +376,10 @@ AdaBoostDecisionTree::WeakClassifier::~WeakClassifier()
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
-
-bool AdaBoostDecisionTree::WeakClassifier::Predict(const LArMvaHelper::MvaFeatureVector &features) const
-{
-    return this->EvaluateNode(0, features);
-}
-
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool AdaBoostDecisionTree::WeakClassifier::EvaluateNode(const int nodeId, const LArMvaHelper::MvaFeatureVector &features) const
-{
-    const Node *pActiveNode(nullptr);
-
-    if (m_idToNodeMap.find(nodeId) != m_idToNodeMap.end())
-    {
-        pActiveNode = m_idToNodeMap.at(nodeId);
-    }
-    else
-    {
-        throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
-    }
-
-    if (pActiveNode->IsLeaf())
-        return pActiveNode->GetOutcome();
-
-    if (static_cast<int>(features.size()) <= pActiveNode->GetVariableId())
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
-
-    if (features.at(pActiveNode->GetVariableId()).Get() <= pActiveNode->GetThreshold())
-    {
-        return this->EvaluateNode(pActiveNode->GetLeftChildNodeId(), features);
-    }
-    else
-    {
-        return this->EvaluateNode(pActiveNode->GetRightChildNodeId(), features);
-    }
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-AdaBoostDecisionTree::StrongClassifier::StrongClassifier(const TiXmlHandle *const pXmlHandle)
+AdaBoostDecisionTree::StrongClassifier::StrongClassifier(const TiXmlHandle *const pXmlHandle) :
+    m_totalWeight(0.)
 {
     TiXmlElement *pCurrentXmlElement = pXmlHandle->FirstChild().Element();
 
@@ -377,14 +390,19 @@ AdaBoostDecisionTree::StrongClassifier::StrongClassifier(const TiXmlHandle *cons
 
         pCurrentXmlElement = pCurrentXmlElement->NextSiblingElement();
     }
+
+    this->MakeFlatForest();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-AdaBoostDecisionTree::StrongClassifier::StrongClassifier(const StrongClassifier &rhs)
+AdaBoostDecisionTree::StrongClassifier::StrongClassifier(const StrongClassifier &rhs) :
+    m_totalWeight(0.)
 {
     for (const WeakClassifier *const pWeakClassifier : rhs.m_weakClassifiers)
         m_weakClassifiers.emplace_back(new WeakClassifier(*pWeakClassifier));
+
+    this->MakeFlatForest();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -395,6 +413,8 @@ AdaBoostDecisionTree::StrongClassifier &AdaBoostDecisionTree::StrongClassifier::
     {
         for (const WeakClassifier *const pWeakClassifier : rhs.m_weakClassifiers)
             m_weakClassifiers.emplace_back(new WeakClassifier(*pWeakClassifier));
+
+        this->MakeFlatForest();
     }
 
     return *this;
@@ -412,25 +432,23 @@ AdaBoostDecisionTree::StrongClassifier::~StrongClassifier()
 
 double AdaBoostDecisionTree::StrongClassifier::Predict(const LArMvaHelper::MvaFeatureVector &features) const
 {
-    double score(0.), weights(0.);
+    double score(0.);
 
-    for (const WeakClassifier *const pWeakClassifier : m_weakClassifiers)
+    for (unsigned int treeIndex = 0; treeIndex < m_treeWeights.size(); ++treeIndex)
     {
-        weights += pWeakClassifier->GetWeight();
-
-        if (pWeakClassifier->Predict(features))
+        if (this->EvaluateTree(treeIndex, features))
         {
-            score += pWeakClassifier->GetWeight();
+            score += m_treeWeights[treeIndex];
         }
         else
         {
-            score -= pWeakClassifier->GetWeight();
+            score -= m_treeWeights[treeIndex];
         }
     }
 
-    if (weights > std::numeric_limits<double>::epsilon())
+    if (m_totalWeight > std::numeric_limits<double>::epsilon())
     {
-        score /= weights;
+        score /= m_totalWeight;
     }
     else
     {
@@ -442,6 +460,38 @@ double AdaBoostDecisionTree::StrongClassifier::Predict(const LArMvaHelper::MvaFe
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void AdaBoostDecisionTree::StrongClassifier::Predict(const MvaTypes::MvaFeatureVectorVector &featuresVector,
+    std::vector<double> &scores) const
+{
+    // ATTN Each score accumulates the tree weights in tree order, exactly as for a single set of input features
+    std::vector<double> batchScores(featuresVector.size(), 0.);
+
+    for (unsigned int treeIndex = 0; treeIndex < m_treeWeights.size(); ++treeIndex)
+    {
+        for (unsigned int index = 0; index < featuresVector.size(); ++index)
+        {
+            if (this->EvaluateTree(treeIndex, featuresVector[index]))
+            {
+                batchScores[index] += m_treeWeights[treeIndex];
+            }
+            else
+            {
+                batchScores[index] -= m_treeWeights[treeIndex];
+            }
+        }
+    }
+
+    if (!(m_totalWeight > std::numeric_limits<double>::epsilon()))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    scores.reserve(scores.size() + batchScores.size());
+
+    for (const double score : batchScores)
+        scores.emplace_back(score / m_totalWeight);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode AdaBoostDecisionTree::StrongClassifier::ReadComponent(TiXmlElement *pCurrentXmlElement)
 {
     const std::string componentName(pCurrentXmlElement->ValueStr());
@@ -459,4 +509,73 @@ StatusCode AdaBoostDecisionTree::StrongClassifier::ReadComponent(TiXmlElement *p
     return STATUS_CODE_INVALID_PARAMETER;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AdaBoostDecisionTree::StrongClassifier::MakeFlatForest()
+{
+    m_treeRootIndices.clear();
+    m_treeWeights.clear();
+    m_totalWeight = 0.;
+    m_nodeOutcomes.clear();
+    m_nodeVariableIds.clear();
+    m_nodeThresholds.clear();
+    m_nodeChildIndices.clear();
+
+    for (const WeakClassifier *const pWeakClassifier : m_weakClassifiers)
+    {
+        const IdToNodeMap &idToNodeMap(pWeakClassifier->GetIdToNodeMap());
+
+        std::map<int, int> idToIndexMap;
+        int nodeIndex(static_cast<int>(m_nodeOutcomes.size()));
+
+        for (const auto &mapEntry : idToNodeMap)
+            idToIndexMap.insert(std::map<int, int>::value_type(mapEntry.first, nodeIndex++));
+
+        const auto getIndex = [&idToIndexMap](const int nodeId) -> int
+        {
+            const auto iter(idToIndexMap.find(nodeId));
+            return ((idToIndexMap.end() != iter) ? iter->second : -1);
+        };
+
+        for (const auto &mapEntry : idToNodeMap)
+        {
+            const Node *const pNode(mapEntry.second);
+            m_nodeOutcomes.emplace_back(pNode->IsLeaf() ? (pNode->GetOutcome() ? 1 : 0) : -1);
+            m_nodeVariableIds.emplace_back(pNode->GetVariableId());
+            m_nodeThresholds.emplace_back(pNode->GetThreshold());
+            m_nodeChildIndices.emplace_back(pNode->IsLeaf() ? -1 : getIndex(pNode->GetLeftChildNodeId()));
+            m_nodeChildIndices.emplace_back(pNode->IsLeaf() ? -1 : getIndex(pNode->GetRightChildNodeId()));
+        }
+
+        m_treeRootIndices.emplace_back(getIndex(0));
+        m_treeWeights.emplace_back(pWeakClassifier->GetWeight());
+        m_totalWeight += pWeakClassifier->GetWeight();
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool AdaBoostDecisionTree::StrongClassifier::EvaluateTree(const unsigned int treeIndex,
+    const LArMvaHelper::MvaFeatureVector &features) const
+{
+    int nodeIndex(m_treeRootIndices[treeIndex]);
+
+    while (nodeIndex >= 0)
+    {
+        const int outcome(m_nodeOutcomes[nodeIndex]);
+
+        if (outcome >= 0)
+            return (outcome > 0);
+
+        const int variableId(m_nodeVariableIds[nodeIndex]);
+
+        if ((variableId < 0) || (static_cast<int>(features.size()) <= variableId))
+            throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+        nodeIndex = m_nodeChildIndices[2 * nodeIndex + ((features[variableId].Get() <= m_nodeThresholds[nodeIndex]) ? 0 : 1)];
+    }
+
+    throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
+}
+
 } // namespace lar_content
@@ -88,6 +88,22 @@ public:
      */
     double CalculateProbability(const LArMvaHelper::MvaFeatureVector &features) const;
 
+    /**
+     *  @brief  Calculate the classification scores for a batch of sets of input features, based on the trained model
+     *
+     *  @param  featuresVector the sets of input features
+     *  @param  scores to receive the classification scores, in the order of the sets of input features
+     */
+    void CalculateClassificationScores(const MvaTypes::MvaFeatureVectorVector &featuresVector, std::vector<double> &scores) const;
+
+    /**
+     *  @brief  Calculate the classification probabilities for a batch of sets of input features, based on the trained model
+     *
+     *  @param  featuresVector the sets of input features
+     *  @param  probabilities to receive the classification probabilities, in the order of the sets of input features
+     */
+    void CalculateProbabilities(const MvaTypes::MvaFeatureVectorVector &featuresVector, std::vector<double> &probabilities) const;
+
 private:
     /**
      *  @brief Node class used for representing a decision tree
@@ -223,23 +239,11 @@ private:
         ~WeakClassifier();
 
         /**
-         *  @brief  Predict signal or background based on trained data
-         *
-         *  @param  features the input features
-         *
-         *  @return is signal or background
-         */
-        bool Predict(const LArMvaHelper::MvaFeatureVector &features) const;
-
-        /**
-         *  @brief  Evalute node and return outcome
+         *  @brief  Get the decision tree nodes
          *
-         *  @param  nodeId current node id
-         *  @param  features the input features
-         *
-         *  @return is signal or background node
+         *  @return the map from node id to node
          */
-        bool EvaluateNode(const int nodeId, const LArMvaHelper::MvaFeatureVector &features) const;
+        const IdToNodeMap &GetIdToNodeMap() const;
 
         /**
          *  @brief  Get boost weight for weak classifier
@@ -304,13 +308,44 @@ private:
          */
         double Predict(const LArMvaHelper::MvaFeatureVector &features) const;
 
+        /**
+         *  @brief  Predict signal or background for a batch of sets of input features, evaluating each tree for every set in turn
+         *
+         *  @param  featuresVector the sets of input features
+         *  @param  scores to receive the scores produced from trained model, in the order of the sets of input features
+         */
+        void Predict(const MvaTypes::MvaFeatureVectorVector &featuresVector, std::vector<double> &scores) const;
+
     private:
         /**
          *  @brief  Read xml element and if weak classifier add to member variables
          */
         pandora::StatusCode ReadComponent(pandora::TiXmlElement *pCurrentXmlElement);
 
-        WeakClassifiers m_weakClassifiers; ///< Vector of weak classifers
+        /**
+         *  @brief  Build the flattened representation of the weak classifiers, with the nodes of all trees held in contiguous arrays and
+         *          children referenced by index
+         */
+        void MakeFlatForest();
+
+        /**
+         *  @brief  Evaluate a tree of the flattened forest
+         *
+         *  @param  treeIndex the tree index
+         *  @param  features the input features
+         *
+         *  @return is signal or background
+         */
+        bool EvaluateTree(const unsigned int treeIndex, const LArMvaHelper::MvaFeatureVector &features) const;
+
+        WeakClassifiers m_weakClassifiers;     ///< Vector of weak classifers
+        pandora::IntVector m_treeRootIndices;  ///< The index of the root node of each tree, or -1 if there is no root node
+        std::vector<double> m_treeWeights;     ///< The boost weight of each tree
+        double m_totalWeight;                  ///< The sum of the boost weights, accumulated in tree order
+        pandora::IntVector m_nodeOutcomes;     ///< The outcome of each node: 0 or 1 for a leaf and -1 for a decision node
+        pandora::IntVector m_nodeVariableIds;  ///< The variable cut on by each decision node
+        std::vector<double> m_nodeThresholds;  ///< The threshold used by each decision node
+        pandora::IntVector m_nodeChildIndices; ///< The left and right child indices of each node, interleaved, or -1 if there is no child
     };
 
     /**
@@ -322,6 +357,21 @@ private:
      */
     double CalculateScore(const LArMvaHelper::MvaFeatureVector &features) const;
 
+    /**
+     *  @brief  Calculate scores for a batch of sets of input features using strong classifier
+     *
+     *  @param  featuresVector the sets of input features
+     *  @param  scores to receive the scores, in the order of the sets of input features
+     */
+    void CalculateScores(const MvaTypes::MvaFeatureVectorVector &featuresVector, std::vector<double> &scores) const;
+
+    /**
+     *  @brief  Report an exception raised when calculating scores using strong classifier
+     *
+     *  @param  statusCodeException the exception
+     */
+    void ReportScoreException(const pandora::StatusCodeException &statusCodeException) const;
+
     StrongClassifier *m_pStrongClassifier; ///< Strong adaptive boost tree classifier
 };
 
@@ -395,6 +445,13 @@ inline int AdaBoostDecisionTree::WeakClassifier::GetTreeId() const
     return m_treeId;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const AdaBoostDecisionTree::IdToNodeMap &AdaBoostDecisionTree::WeakClassifier::GetIdToNodeMap() const
+{
+    return m_idToNodeMap;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_ADABOOST_DECISION_TREE_H
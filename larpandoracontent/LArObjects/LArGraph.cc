@@ -9,6 +9,7 @@
 #include "larpandoracontent/LArObjects/LArGraph.h"
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -44,39 +45,53 @@ const LArGraph::EdgeVector &LArGraph::GetEdges() const
 
 void LArGraph::MakeGraph(const CaloHitList &caloHitList)
 {
-    Eigen::MatrixXf hitMatrix(caloHitList.size(), 2);
-    this->Vectorize(caloHitList, hitMatrix);
-    // Edges can be double-counted, so use map of maps to avoid this
-    std::map<const CaloHit *, std::map<const CaloHit *, bool>> edgeMap;
-    for (int r = 0; r < hitMatrix.rows(); ++r)
+    const CaloHitVector caloHitVector(caloHitList.begin(), caloHitList.end());
+    IndexKDTree kdTree;
+    this->BuildKDTree(caloHitVector, kdTree);
+
+    // Edges can be double-counted, so collect them in a flat vector, ordered by endpoint address, and remove duplicates once filled
+    HitPairVector hitPairs;
+    const auto addEdge = [&hitPairs](const CaloHit *const pCaloHit1, const CaloHit *const pCaloHit2)
+    {
+        if (std::less<const CaloHit *>()(pCaloHit2, pCaloHit1))
+            hitPairs.emplace_back(pCaloHit2, pCaloHit1);
+        else
+            hitPairs.emplace_back(pCaloHit1, pCaloHit2);
+    };
+
+    // ATTN A lone hit is its own nearest neighbour
+    if (1 == caloHitVector.size())
+        addEdge(caloHitVector.front(), caloHitVector.front());
+
+    const int nSecondaryCandidates{std::min(2 * this->m_nSourceEdges, 5 + this->m_nSourceEdges)};
+    const unsigned int nNeighbours{2 + static_cast<unsigned int>(std::max(0, nSecondaryCandidates))};
+
+    for (unsigned int r = 0; r < caloHitVector.size(); ++r)
     {
-        Eigen::RowVectorXf row(2);
-        row << hitMatrix(r, 0), hitMatrix(r, 1);
-        Eigen::MatrixXf norms((hitMatrix.rowwise() - row).array().pow(2).rowwise().sum());
-        norms(r, 0) = std::numeric_limits<float>::max();
-        Eigen::Index index;
-        norms.col(0).minCoeff(&index);
-        auto iter0{caloHitList.begin()};
-        std::advance(iter0, r);
-        auto iter1{caloHitList.begin()};
-        std::advance(iter1, index);
-        edgeMap[*iter0][*iter1] = true;
-        edgeMap[*iter1][*iter0] = true;
-        norms(index, 0) = std::numeric_limits<float>::max();
+        const CaloHit *const pCaloHit0{caloHitVector[r]};
+        DistanceIndexVector neighbours;
+        this->GetNearestHits(kdTree, caloHitVector, pCaloHit0->GetPositionVector(), nNeighbours, neighbours);
+        neighbours.erase(std::remove_if(neighbours.begin(), neighbours.end(),
+                             [r](const DistanceIndexPair &neighbour) { return neighbour.second == r; }),
+            neighbours.end());
+
+        if (neighbours.empty())
+            continue;
+
+        const CaloHit *const pCaloHit1{caloHitVector[neighbours.front().second]};
+        addEdge(pCaloHit0, pCaloHit1);
         // Create a limited number of additional edges within a maximum distance and avoiding colinearity with existing edges
         int nEdges{1};
-        CartesianPointVector sourceEdges({((*iter1)->GetPositionVector() - (*iter0)->GetPositionVector()).GetUnitVector()});
-        for (int i = 1; i <= std::min(2 * this->m_nSourceEdges, 5 + this->m_nSourceEdges); ++i)
+        CartesianPointVector sourceEdges({(pCaloHit1->GetPositionVector() - pCaloHit0->GetPositionVector()).GetUnitVector()});
+        for (int i = 1; (i <= nSecondaryCandidates) && (i < static_cast<int>(neighbours.size())); ++i)
         {
             if (nEdges >= this->m_nSourceEdges)
                 break;
-            auto val{norms.col(0).minCoeff(&index)};
-            if (val > this->m_maxSecondaryDistance)
-                continue;
-            auto iter2{caloHitList.begin()};
-            std::advance(iter2, index);
-            norms(index, 0) = std::numeric_limits<float>::max();
-            const CartesianVector &vec{((*iter2)->GetPositionVector() - (*iter0)->GetPositionVector()).GetUnitVector()};
+            // Neighbours are ordered by distance, so once one is too far away all remaining candidates are too
+            if (neighbours[i].first > this->m_maxSecondaryDistance)
+                break;
+            const CaloHit *const pCaloHit2{caloHitVector[neighbours[i].second]};
+            const CartesianVector &vec{(pCaloHit2->GetPositionVector() - pCaloHit0->GetPositionVector()).GetUnitVector()};
             bool notColinear{true};
             for (const CartesianVector &other : sourceEdges)
             {
@@ -89,28 +104,15 @@ void LArGraph::MakeGraph(const CaloHitList &caloHitList)
             if (notColinear)
             {
                 sourceEdges.emplace_back(vec);
-                edgeMap[*iter0][*iter2] = true;
-                edgeMap[*iter2][*iter0] = true;
+                addEdge(pCaloHit0, pCaloHit2);
                 ++nEdges;
             }
         }
     }
-    std::map<const CaloHit *, std::map<const CaloHit *, bool>> usedEdges;
-    for (const auto &[pCaloHit1, map] : edgeMap)
-    {
-        for (const auto &[pCaloHit2, dummy] : map)
-        {
-            if (usedEdges.find(pCaloHit1) != usedEdges.end())
-            {
-                std::map<const CaloHit *, bool> &innerMap{usedEdges[pCaloHit1]};
-                if (innerMap.find(pCaloHit2) != innerMap.end())
-                    continue;
-            }
-            usedEdges[pCaloHit1][pCaloHit2] = true;
-            usedEdges[pCaloHit2][pCaloHit1] = true;
-            this->m_edges.emplace_back(new Edge(pCaloHit1, pCaloHit2));
-        }
-    }
+    std::sort(hitPairs.begin(), hitPairs.end(), std::less<HitPair>());
+    hitPairs.erase(std::unique(hitPairs.begin(), hitPairs.end()), hitPairs.end());
+    for (const HitPair &hitPair : hitPairs)
+        this->m_edges.emplace_back(new Edge(hitPair.first, hitPair.second));
     if (m_fullyConnect)
     {
         HitEdgeMap hitToEdgesMap;
@@ -178,8 +180,9 @@ void LArGraph::ConnectRegions(const HitConnectionsMap &graphs, HitEdgeMap &hitTo
     for (const auto &[pCaloHit1, caloHitList1] : graphs)
     {
         ++i;
-        Eigen::MatrixXf subGraphMatrix(caloHitList1.size(), 2);
-        this->Vectorize(caloHitList1, subGraphMatrix);
+        const CaloHitVector caloHitVector1(caloHitList1.begin(), caloHitList1.end());
+        IndexKDTree kdTree;
+        this->BuildKDTree(caloHitVector1, kdTree);
         float closestApproach{std::numeric_limits<float>::max()};
         const CaloHit *pClosestHit1{nullptr};
         const CaloHit *pClosestHit2{nullptr};
@@ -192,17 +195,14 @@ void LArGraph::ConnectRegions(const HitConnectionsMap &graphs, HitEdgeMap &hitTo
                 continue;
             for (const CaloHit *const pCaloHit : caloHitList2)
             {
-                const CartesianVector &pos{pCaloHit->GetPositionVector()};
-                Eigen::RowVectorXf row(2);
-                row << pos.GetX(), pos.GetZ();
-                Eigen::MatrixXf norms((subGraphMatrix.rowwise() - row).array().pow(2).rowwise().sum());
-                Eigen::Index index;
-                float val{norms.col(0).minCoeff(&index)};
+                DistanceIndexVector neighbours;
+                this->GetNearestHits(kdTree, caloHitVector1, pCaloHit->GetPositionVector(), 1, neighbours);
+                if (neighbours.empty())
+                    continue;
+                const float val{neighbours.front().first};
                 if (val < closestApproach)
                 {
-                    auto iter{caloHitList1.begin()};
-                    std::advance(iter, index);
-                    pClosestHit1 = *iter;
+                    pClosestHit1 = caloHitVector1[neighbours.front().second];
                     pClosestHit2 = pCaloHit;
                     closestApproach = val;
                     idx1 = i;
@@ -224,16 +224,58 @@ void LArGraph::ConnectRegions(const HitConnectionsMap &graphs, HitEdgeMap &hitTo
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void LArGraph::Vectorize(const CaloHitList &caloHitList, Eigen::MatrixXf &hitMatrix) const
+void LArGraph::BuildKDTree(const CaloHitVector &caloHitVector, IndexKDTree &kdTree) const
 {
-    int i{0};
-    for (const CaloHit *const pCaloHit : caloHitList)
+    if (caloHitVector.empty())
+        return;
+
+    IndexKDNodeVector kdNodes;
+    kdNodes.reserve(caloHitVector.size());
+    float minX{std::numeric_limits<float>::max()}, maxX{std::numeric_limits<float>::lowest()};
+    float minZ{std::numeric_limits<float>::max()}, maxZ{std::numeric_limits<float>::lowest()};
+    for (unsigned int i = 0; i < caloHitVector.size(); ++i)
     {
-        const CartesianVector &pos{pCaloHit->GetPositionVector()};
-        hitMatrix(i, 0) = pos.GetX();
-        hitMatrix(i, 1) = pos.GetZ();
-        ++i;
+        const CartesianVector &pos{caloHitVector[i]->GetPositionVector()};
+        kdNodes.emplace_back(i, pos.GetX(), pos.GetZ());
+        minX = std::min(minX, pos.GetX());
+        maxX = std::max(maxX, pos.GetX());
+        minZ = std::min(minZ, pos.GetZ());
+        maxZ = std::max(maxZ, pos.GetZ());
     }
+    kdTree.build(kdNodes, KDTreeBox(minX, maxX, minZ, maxZ));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArGraph::GetNearestHits(const IndexKDTree &kdTree, const CaloHitVector &caloHitVector, const CartesianVector &position,
+    const unsigned int nNeighbours, DistanceIndexVector &neighbours) const
+{
+    IndexKDNodeVector nearestNodes;
+    kdTree.findKNearestNeighbours(IndexKDNode(0, position.GetX(), position.GetZ()), nNeighbours, nearestNodes);
+    if (nearestNodes.empty())
+        return;
+
+    // The kd tree ranks hits in double precision and breaks ties by tree position, so gather every hit out to (just beyond) the furthest
+    // of the k nearest and rank them by the same single precision distance and hit index as a full scan
+    const CartesianVector &furthest{caloHitVector[nearestNodes.back().data]->GetPositionVector()};
+    const float radius{std::sqrt(this->GetDistanceSquared(furthest, position))};
+    const float span{radius * (1.f + 1.e-4f) + 1.e-4f};
+    IndexKDNodeVector foundNodes;
+    kdTree.search(build_2d_kd_search_region(position, span, span), foundNodes);
+
+    neighbours.reserve(foundNodes.size());
+    for (const IndexKDNode &node : foundNodes)
+        neighbours.emplace_back(this->GetDistanceSquared(caloHitVector[node.data]->GetPositionVector(), position), node.data);
+    std::sort(neighbours.begin(), neighbours.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArGraph::GetDistanceSquared(const CartesianVector &position, const CartesianVector &reference) const
+{
+    const float dx{position.GetX() - reference.GetX()}, dz{position.GetZ() - reference.GetZ()};
+
+    return dx * dx + dz * dz;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -10,7 +10,7 @@
 
 #include "Objects/Cluster.h"
 
-#include <Eigen/Dense>
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
 namespace lar_content
 {
@@ -118,13 +118,45 @@ private:
      */
     void ConnectRegions(const HitConnectionsMap &graphs, HitEdgeMap &hitToEdgesMap);
 
+    typedef KDTreeLinkerAlgo<unsigned int, 2> IndexKDTree;
+    typedef KDTreeNodeInfoT<unsigned int, 2> IndexKDNode;
+    typedef std::vector<IndexKDNode> IndexKDNodeVector;
+    typedef std::pair<float, unsigned int> DistanceIndexPair;
+    typedef std::vector<DistanceIndexPair> DistanceIndexVector;
+    typedef std::pair<const pandora::CaloHit *, const pandora::CaloHit *> HitPair;
+    typedef std::vector<HitPair> HitPairVector;
+
     /**
-     *  @brief  Convert a list of calo hits into an Eigen matrix.
+     *  @brief  Build a kd tree over a vector of calo hits, with each node holding the index of its hit in the vector
      *
-     *  @param  caloHitList the calo hit list containing the hits from which to construct a graph
-     *  @param  hitMatrix the output Eigen matrix
+     *  @param  caloHitVector the calo hits
+     *  @param  kdTree the output kd tree
+     */
+    void BuildKDTree(const pandora::CaloHitVector &caloHitVector, IndexKDTree &kdTree) const;
+
+    /**
+     *  @brief  Find the calo hits nearest to a position, ordered by squared distance and then by index in the calo hit vector. At least
+     *          nNeighbours hits are returned (if available) and the leading nNeighbours are exactly those a full scan of the calo hit
+     *          vector would select, irrespective of ties and rounding in the kd tree
+     *
+     *  @param  kdTree the kd tree built over the calo hit vector
+     *  @param  caloHitVector the calo hits
+     *  @param  position the position about which to search
+     *  @param  nNeighbours the number of nearest hits required
+     *  @param  neighbours the output squared distances and calo hit indices
+     */
+    void GetNearestHits(const IndexKDTree &kdTree, const pandora::CaloHitVector &caloHitVector, const pandora::CartesianVector &position,
+        const unsigned int nNeighbours, DistanceIndexVector &neighbours) const;
+
+    /**
+     *  @brief  Calculate the squared distance between two positions in the x-z plane
+     *
+     *  @param  position the position
+     *  @param  reference the reference position
+     *
+     *  @return the squared distance
      */
-    void Vectorize(const pandora::CaloHitList &caloHitList, Eigen::MatrixXf &hitMatrix) const;
+    float GetDistanceSquared(const pandora::CartesianVector &position, const pandora::CartesianVector &reference) const;
 
     EdgeVector m_edges;           ///< The edges defining the graph
     bool m_fullyConnect;          ///< Whether or not to connect any disconnected regions
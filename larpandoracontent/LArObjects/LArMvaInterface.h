@@ -81,6 +81,7 @@ public:
 
     typedef InitializedDouble MvaFeature;
     typedef std::vector<MvaFeature> MvaFeatureVector;
+    typedef std::vector<MvaFeatureVector> MvaFeatureVectorVector;
     typedef std::map<std::string, MvaFeature> MvaFeatureMap;
 };
 
@@ -119,6 +120,22 @@ public:
      */
     virtual double CalculateProbability(const MvaTypes::MvaFeatureVector &features) const = 0;
 
+    /**
+     *  @brief  Calculate the classification scores for a batch of sets of input features, based on the trained model
+     *
+     *  @param  featuresVector the sets of input features
+     *  @param  scores to receive the classification scores, in the order of the sets of input features
+     */
+    virtual void CalculateClassificationScores(const MvaTypes::MvaFeatureVectorVector &featuresVector, std::vector<double> &scores) const;
+
+    /**
+     *  @brief  Calculate the classification probabilities for a batch of sets of input features, based on the trained model
+     *
+     *  @param  featuresVector the sets of input features
+     *  @param  probabilities to receive the classification probabilities, in the order of the sets of input features
+     */
+    virtual void CalculateProbabilities(const MvaTypes::MvaFeatureVectorVector &featuresVector, std::vector<double> &probabilities) const;
+
     /**
      *  @brief  Destructor
      */
@@ -190,6 +207,29 @@ inline bool MvaTypes::InitializedDouble::IsInitialized() const
     return m_isInitialized;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void MvaInterface::CalculateClassificationScores(const MvaTypes::MvaFeatureVectorVector &featuresVector,
+    std::vector<double> &scores) const
+{
+    scores.reserve(scores.size() + featuresVector.size());
+
+    for (const MvaTypes::MvaFeatureVector &features : featuresVector)
+        scores.emplace_back(this->CalculateClassificationScore(features));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void MvaInterface::CalculateProbabilities(const MvaTypes::MvaFeatureVectorVector &featuresVector,
+    std::vector<double> &probabilities) const
+{
+    probabilities.reserve(probabilities.size() + featuresVector.size());
+
+    for (const MvaTypes::MvaFeatureVector &features : featuresVector)
+        probabilities.emplace_back(this->CalculateProbability(features));
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_MVA_INTERFACE_H
@@ -26,7 +26,8 @@ SupportVectorMachine::SupportVectorMachine() :
     m_scaleFactor(1.),
     m_kernelType(QUADRATIC),
     m_kernelFunction(QuadraticKernel),
-    m_kernelMap{{LINEAR, LinearKernel}, {QUADRATIC, QuadraticKernel}, {CUBIC, CubicKernel}, {GAUSSIAN_RBF, GaussianRbfKernel}}
+    m_kernelMap{{LINEAR, LinearKernel}, {QUADRATIC, QuadraticKernel}, {CUBIC, CubicKernel}, {GAUSSIAN_RBF, GaussianRbfKernel}},
+    m_useKernelFunction(false)
 {
 }
 
@@ -67,6 +68,18 @@ StatusCode SupportVectorMachine::Initialize(const std::string &parameterLocation
         }
     }
 
+    // Hold the support vectors contiguously for the built-in kernels
+    m_supportVectorMatrix.reserve(m_svInfoList.size() * m_nFeatures);
+    m_yAlphaValues.reserve(m_svInfoList.size());
+
+    for (const SupportVectorInfo &svInfo : m_svInfoList)
+    {
+        for (const LArMvaHelper::MvaFeature &value : svInfo.m_supportVector)
+            m_supportVectorMatrix.push_back(value.Get());
+
+        m_yAlphaValues.push_back(svInfo.m_yAlpha);
+    }
+
     // There's the possibility of a user-defined kernel that doesn't use this as a divisor but let's be safe
     if (m_scaleFactor < std::numeric_limits<double>::epsilon())
     {
@@ -140,6 +153,35 @@ void SupportVectorMachine::ReadXmlFile(const std::string &svmFileName, const std
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void SupportVectorMachine::CalculateClassificationScores(const MvaTypes::MvaFeatureVectorVector &featuresVector,
+    std::vector<double> &scores) const
+{
+    this->CalculateClassificationScoresImpl(featuresVector, scores);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SupportVectorMachine::CalculateProbabilities(const MvaTypes::MvaFeatureVectorVector &featuresVector,
+    std::vector<double> &probabilities) const
+{
+    if (!m_enableProbability)
+    {
+        std::cout << "LArSupportVectorMachine: cannot calculate probabilities for this SVM" << std::endl;
+        throw pandora::STATUS_CODE_NOT_INITIALIZED;
+    }
+
+    std::vector<double> scores;
+    this->CalculateClassificationScoresImpl(featuresVector, scores);
+
+    // ATTN: See CalculateProbability for the mapping of the score to a probability
+    probabilities.reserve(probabilities.size() + scores.size());
+
+    for (const double score : scores)
+        probabilities.emplace_back(1. / (1. + std::exp(m_probAParameter * score + m_probBParameter)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode SupportVectorMachine::ReadComponent(TiXmlElement *pCurrentXmlElement)
 {
     const std::string componentName(pCurrentXmlElement->ValueStr());
@@ -194,7 +236,10 @@ StatusCode SupportVectorMachine::ReadMachine(const TiXmlHandle &currentHandle)
     m_probBParameter = probBParameter;
 
     if (kernelType != USER_DEFINED) // if user-defined, leave it so it alone can be set before/after initialization
+    {
         m_kernelFunction = m_kernelMap.at(m_kernelType);
+        m_useKernelFunction = false;
+    }
 
     return STATUS_CODE_SUCCESS;
 }
@@ -248,6 +293,52 @@ StatusCode SupportVectorMachine::ReadSupportVector(const TiXmlHandle &currentHan
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 double SupportVectorMachine::CalculateClassificationScoreImpl(const LArMvaHelper::MvaFeatureVector &features) const
+{
+    this->CheckClassificationPossible();
+
+    if (this->UseKernelFunction())
+        return this->CalculateKernelFunctionScore(features);
+
+    std::vector<double> featureValues;
+    featureValues.reserve(m_nFeatures);
+    this->AppendFeatureValues(features, featureValues);
+
+    std::vector<double> scores(1, 0.);
+    this->CalculateScores(featureValues, scores);
+
+    return scores.front();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SupportVectorMachine::CalculateClassificationScoresImpl(const MvaTypes::MvaFeatureVectorVector &featuresVector,
+    std::vector<double> &scores) const
+{
+    this->CheckClassificationPossible();
+    scores.reserve(scores.size() + featuresVector.size());
+
+    if (this->UseKernelFunction())
+    {
+        for (const LArMvaHelper::MvaFeatureVector &features : featuresVector)
+            scores.emplace_back(this->CalculateKernelFunctionScore(features));
+
+        return;
+    }
+
+    std::vector<double> featureValues;
+    featureValues.reserve(featuresVector.size() * m_nFeatures);
+
+    for (const LArMvaHelper::MvaFeatureVector &features : featuresVector)
+        this->AppendFeatureValues(features, featureValues);
+
+    std::vector<double> batchScores(featuresVector.size(), 0.);
+    this->CalculateScores(featureValues, batchScores);
+    scores.insert(scores.end(), batchScores.begin(), batchScores.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SupportVectorMachine::CheckClassificationPossible() const
 {
     if (!m_isInitialized)
     {
@@ -261,7 +352,12 @@ double SupportVectorMachine::CalculateClassificationScoreImpl(const LArMvaHelper
                   << std::endl;
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
     }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
 
+double SupportVectorMachine::CalculateKernelFunctionScore(const LArMvaHelper::MvaFeatureVector &features) const
+{
     LArMvaHelper::MvaFeatureVector standardizedFeatures;
     standardizedFeatures.reserve(m_nFeatures);
 
@@ -281,4 +377,98 @@ double SupportVectorMachine::CalculateClassificationScoreImpl(const LArMvaHelper
     return classScore + m_bias;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SupportVectorMachine::AppendFeatureValues(const LArMvaHelper::MvaFeatureVector &features, std::vector<double> &featureValues) const
+{
+    for (unsigned int i = 0; i < m_nFeatures; ++i)
+    {
+        const double value(features.at(i).Get());
+        featureValues.push_back(m_standardizeFeatures ? m_featureInfoList[i].StandardizeParameter(value) : value);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SupportVectorMachine::CalculateScores(const std::vector<double> &featureValues, std::vector<double> &scores) const
+{
+    switch (m_kernelType)
+    {
+        case LINEAR:
+            return this->CalculateScores<LINEAR>(featureValues, scores);
+        case QUADRATIC:
+            return this->CalculateScores<QUADRATIC>(featureValues, scores);
+        case CUBIC:
+            return this->CalculateScores<CUBIC>(featureValues, scores);
+        case GAUSSIAN_RBF:
+            return this->CalculateScores<GAUSSIAN_RBF>(featureValues, scores);
+        default:
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <SupportVectorMachine::KernelType KERNEL_TYPE>
+void SupportVectorMachine::CalculateScores(const std::vector<double> &featureValues, std::vector<double> &scores) const
+{
+    if ((GAUSSIAN_RBF != KERNEL_TYPE) && (m_scaleFactor * m_scaleFactor < std::numeric_limits<double>::epsilon()))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const unsigned int nSupportVectors(m_yAlphaValues.size());
+    const unsigned int nSets(scores.size());
+    const double *const pSupportVectorMatrix(m_supportVectorMatrix.data());
+    const double *const pFeatureValues(featureValues.data());
+
+    for (unsigned int svIndex = 0; svIndex < nSupportVectors; ++svIndex)
+    {
+        const double yAlpha(m_yAlphaValues[svIndex]);
+        const double *const pSupportVector(pSupportVectorMatrix + svIndex * m_nFeatures);
+
+        for (unsigned int setIndex = 0; setIndex < nSets; ++setIndex)
+        {
+            const double *const pSetFeatureValues(pFeatureValues + setIndex * m_nFeatures);
+            scores[setIndex] += yAlpha * EvaluateKernel<KERNEL_TYPE>(pSupportVector, pSetFeatureValues, m_nFeatures, m_scaleFactor);
+        }
+    }
+
+    for (double &score : scores)
+        score += m_bias;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <SupportVectorMachine::KernelType KERNEL_TYPE>
+inline double SupportVectorMachine::EvaluateKernel(
+    const double *const pSupportVector, const double *const pFeatureValues, const unsigned int nFeatures, const double scaleFactor)
+{
+    static_assert((LINEAR == KERNEL_TYPE) || (QUADRATIC == KERNEL_TYPE) || (CUBIC == KERNEL_TYPE) || (GAUSSIAN_RBF == KERNEL_TYPE),
+        "SupportVectorMachine: no built-in kernel for this kernel type");
+
+    double total(0.);
+
+    if constexpr (GAUSSIAN_RBF == KERNEL_TYPE)
+    {
+        for (unsigned int i = 0; i < nFeatures; ++i)
+            total += (pSupportVector[i] - pFeatureValues[i]) * (pSupportVector[i] - pFeatureValues[i]);
+
+        return std::exp(-scaleFactor * total);
+    }
+    else
+    {
+        for (unsigned int i = 0; i < nFeatures; ++i)
+            total += pSupportVector[i] * pFeatureValues[i];
+
+        if constexpr (LINEAR == KERNEL_TYPE)
+            return total / (scaleFactor * scaleFactor);
+
+        total = total / (scaleFactor * scaleFactor) + 1.;
+
+        if constexpr (QUADRATIC == KERNEL_TYPE)
+            return total * total;
+
+        return total * total * total;
+    }
+}
+
 } // namespace lar_content
@@ -86,6 +86,22 @@ public:
      */
     double CalculateProbability(const LArMvaHelper::MvaFeatureVector &features) const;
 
+    /**
+     *  @brief  Calculate the classification scores for a batch of sets of input features, based on the trained model
+     *
+     *  @param  featuresVector the sets of input features
+     *  @param  scores to receive the classification scores, in the order of the sets of input features
+     */
+    void CalculateClassificationScores(const MvaTypes::MvaFeatureVectorVector &featuresVector, std::vector<double> &scores) const;
+
+    /**
+     *  @brief  Calculate the classification probabilities for a batch of sets of input features, based on the trained model
+     *
+     *  @param  featuresVector the sets of input features
+     *  @param  probabilities to receive the classification probabilities, in the order of the sets of input features
+     */
+    void CalculateProbabilities(const MvaTypes::MvaFeatureVectorVector &featuresVector, std::vector<double> &probabilities) const;
+
     /**
      *  @brief  Query whether this svm is initialized
      *
@@ -101,7 +117,8 @@ public:
     unsigned int GetNFeatures() const;
 
     /**
-     *  @brief  Set the kernel function to use
+     *  @brief  Set the kernel function to use, in place of the built-in kernel for the kernel type (until a kernel type other than
+     *          USER_DEFINED is read at initialization)
      *
      *  @param  kernelFunction the kernel function
      */
@@ -177,9 +194,13 @@ private:
     SVInfoList m_svInfoList;             ///< The list of SupportVectorInfo objects
     FeatureInfoVector m_featureInfoList; ///< The list of FeatureInfo objects
 
+    std::vector<double> m_supportVectorMatrix; ///< The support vectors, held contiguously in row-major order, one row per vector
+    std::vector<double> m_yAlphaValues;        ///< The alpha-value multiplied by the y-value for each support vector matrix row
+
     KernelType m_kernelType;         ///< The kernel type
     KernelFunction m_kernelFunction; ///< The kernel function
     KernelMap m_kernelMap;           ///< Map from the kernel types to the kernel functions
+    bool m_useKernelFunction;        ///< Whether to use the kernel function set by the user, rather than the built-in kernel
 
     /**
      *  @brief  Read the svm parameters from an xml file
@@ -234,6 +255,75 @@ private:
      */
     double CalculateClassificationScoreImpl(const LArMvaHelper::MvaFeatureVector &features) const;
 
+    /**
+     *  @brief  Implementation method for calculating the classification scores for a batch of sets of input features
+     *
+     *  @param  featuresVector the sets of input features
+     *  @param  scores to receive the classification scores, in the order of the sets of input features
+     */
+    void CalculateClassificationScoresImpl(const MvaTypes::MvaFeatureVectorVector &featuresVector, std::vector<double> &scores) const;
+
+    /**
+     *  @brief  Check that the svm is initialized and has support vectors, so that it can be used for classification
+     */
+    void CheckClassificationPossible() const;
+
+    /**
+     *  @brief  Whether the scores are to be calculated using the kernel function, rather than the built-in kernel for the kernel type
+     *
+     *  @return boolean
+     */
+    bool UseKernelFunction() const;
+
+    /**
+     *  @brief  Calculate the classification score for a set of input features using the kernel function
+     *
+     *  @param  features the input features
+     *
+     *  @return the classification score
+     */
+    double CalculateKernelFunctionScore(const LArMvaHelper::MvaFeatureVector &features) const;
+
+    /**
+     *  @brief  Append the feature values used by the built-in kernels (standardized, if required) for a set of input features
+     *
+     *  @param  features the input features
+     *  @param  featureValues the contiguous feature values, to which m_nFeatures values are appended
+     */
+    void AppendFeatureValues(const LArMvaHelper::MvaFeatureVector &features, std::vector<double> &featureValues) const;
+
+    /**
+     *  @brief  Calculate the classification scores for contiguous sets of feature values using the built-in kernel for the kernel type
+     *
+     *  @param  featureValues the contiguous feature values, m_nFeatures per set of input features
+     *  @param  scores the classification scores, one per set of input features, to which the kernel terms and bias are added
+     */
+    void CalculateScores(const std::vector<double> &featureValues, std::vector<double> &scores) const;
+
+    /**
+     *  @brief  Calculate the classification scores for contiguous sets of feature values using a kernel chosen at compile time. The
+     *          support vector matrix is traversed once for the whole batch, and the terms for each set are summed in support vector order
+     *
+     *  @param  featureValues the contiguous feature values, m_nFeatures per set of input features
+     *  @param  scores the classification scores, one per set of input features, to which the kernel terms and bias are added
+     */
+    template <KernelType KERNEL_TYPE>
+    void CalculateScores(const std::vector<double> &featureValues, std::vector<double> &scores) const;
+
+    /**
+     *  @brief  Evaluate a kernel chosen at compile time, with the same operations as the corresponding kernel function
+     *
+     *  @param  pSupportVector address of the first support vector value
+     *  @param  pFeatureValues address of the first feature value
+     *  @param  nFeatures the number of features
+     *  @param  scaleFactor the scale factor
+     *
+     *  @return result of the kernel operation
+     */
+    template <KernelType KERNEL_TYPE>
+    static double EvaluateKernel(
+        const double *const pSupportVector, const double *const pFeatureValues, const unsigned int nFeatures, const double scaleFactor);
+
     /**
      *  @brief  An inhomogeneous quadratic kernel
      *
@@ -333,6 +423,14 @@ inline unsigned int SupportVectorMachine::GetNFeatures() const
 inline void SupportVectorMachine::SetKernelFunction(KernelFunction kernelFunction)
 {
     m_kernelFunction = std::move(kernelFunction);
+    m_useKernelFunction = true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool SupportVectorMachine::UseKernelFunction() const
+{
+    return (m_useKernelFunction || (USER_DEFINED == m_kernelType));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
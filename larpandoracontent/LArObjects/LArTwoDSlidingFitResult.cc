@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <limits>
 
 using namespace pandora;
@@ -630,11 +631,38 @@ void TwoDSlidingFitResult::FillLayerFitContributionMap(const CartesianPointVecto
     if (!m_layerFitContributionMap.empty())
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
-    for (CartesianPointVector::const_iterator iter = coordinateVector.begin(), iterEnd = coordinateVector.end(); iter != iterEnd; ++iter)
+    if (coordinateVector.empty())
+        return;
+
+    // ATTN Accumulate into contiguous per-layer storage, adding points to each layer in input order, then copy populated layers to the map
+    IntVector layerVector;
+    FloatVector rLVector, rTVector;
+    layerVector.reserve(coordinateVector.size());
+    rLVector.reserve(coordinateVector.size());
+    rTVector.reserve(coordinateVector.size());
+
+    for (const CartesianVector &coordinate : coordinateVector)
     {
         float rL(0.f), rT(0.f);
-        this->GetLocalPosition(*iter, rL, rT);
-        m_layerFitContributionMap[this->GetLayer(rL)].AddPoint(rL, rT);
+        this->GetLocalPosition(coordinate, rL, rT);
+        layerVector.emplace_back(this->GetLayer(rL));
+        rLVector.emplace_back(rL);
+        rTVector.emplace_back(rT);
+    }
+
+    const int innerLayer(*std::min_element(layerVector.begin(), layerVector.end()));
+    const int outerLayer(*std::max_element(layerVector.begin(), layerVector.end()));
+    std::vector<LayerFitContribution> layerFitContributionVector(outerLayer - innerLayer + 1);
+
+    for (unsigned int iPoint = 0; iPoint < layerVector.size(); ++iPoint)
+        layerFitContributionVector[layerVector[iPoint] - innerLayer].AddPoint(rLVector[iPoint], rTVector[iPoint]);
+
+    for (int iLayer = innerLayer; iLayer <= outerLayer; ++iLayer)
+    {
+        const LayerFitContribution &layerFitContribution(layerFitContributionVector[iLayer - innerLayer]);
+
+        if (layerFitContribution.GetNPoints() > 0)
+            (void)m_layerFitContributionMap.emplace_hint(m_layerFitContributionMap.end(), iLayer, layerFitContribution);
     }
 }
 
@@ -653,51 +681,59 @@ void TwoDSlidingFitResult::PerformSlidingLinearFit()
 
     const LayerFitContributionMap &layerFitContributionMap(this->GetLayerFitContributionMap());
     const int innerLayer(layerFitContributionMap.begin()->first);
+    const int outerLayer(layerFitContributionMap.rbegin()->first);
     const int layerFitHalfWindow(static_cast<int>(this->GetLayerFitHalfWindow()));
 
+    // ATTN Dense per-layer lookup, addressed by layer - innerLayer, with null entries for layers absent from the contribution map
+    std::vector<const LayerFitContribution *> layerFitContributionVector(outerLayer - innerLayer + 1, nullptr);
+
+    for (const LayerFitContributionMap::value_type &mapEntry : layerFitContributionMap)
+        layerFitContributionVector[mapEntry.first - innerLayer] = &mapEntry.second;
+
+    const auto getLayerFitContribution = [&](const int iLayer) -> const LayerFitContribution *
+    {
+        return (((iLayer < innerLayer) || (iLayer > outerLayer)) ? nullptr : layerFitContributionVector[iLayer - innerLayer]);
+    };
+
     for (int iLayer = innerLayer; iLayer < innerLayer + layerFitHalfWindow; ++iLayer)
     {
-        LayerFitContributionMap::const_iterator lyrIter = layerFitContributionMap.find(iLayer);
+        const LayerFitContribution *const pLayerFitContribution(getLayerFitContribution(iLayer));
 
-        if (layerFitContributionMap.end() != lyrIter)
+        if (pLayerFitContribution)
         {
-            slidingSumT += lyrIter->second.GetSumT();
-            slidingSumL += lyrIter->second.GetSumL();
-            slidingSumTT += lyrIter->second.GetSumTT();
-            slidingSumLT += lyrIter->second.GetSumLT();
-            slidingSumLL += lyrIter->second.GetSumLL();
-            slidingNPoints += lyrIter->second.GetNPoints();
+            slidingSumT += pLayerFitContribution->GetSumT();
+            slidingSumL += pLayerFitContribution->GetSumL();
+            slidingSumTT += pLayerFitContribution->GetSumTT();
+            slidingSumLT += pLayerFitContribution->GetSumLT();
+            slidingSumLL += pLayerFitContribution->GetSumLL();
+            slidingNPoints += pLayerFitContribution->GetNPoints();
         }
     }
 
-    const int outerLayer(layerFitContributionMap.rbegin()->first);
-
     for (int iLayer = innerLayer; iLayer <= outerLayer; ++iLayer)
     {
-        const int fwdLayer(iLayer + layerFitHalfWindow);
-        LayerFitContributionMap::const_iterator fwdIter = layerFitContributionMap.find(fwdLayer);
+        const LayerFitContribution *const pFwdContribution(getLayerFitContribution(iLayer + layerFitHalfWindow));
 
-        if (layerFitContributionMap.end() != fwdIter)
+        if (pFwdContribution)
         {
-            slidingSumT += fwdIter->second.GetSumT();
-            slidingSumL += fwdIter->second.GetSumL();
-            slidingSumTT += fwdIter->second.GetSumTT();
-            slidingSumLT += fwdIter->second.GetSumLT();
-            slidingSumLL += fwdIter->second.GetSumLL();
-            slidingNPoints += fwdIter->second.GetNPoints();
+            slidingSumT += pFwdContribution->GetSumT();
+            slidingSumL += pFwdContribution->GetSumL();
+            slidingSumTT += pFwdContribution->GetSumTT();
+            slidingSumLT += pFwdContribution->GetSumLT();
+            slidingSumLL += pFwdContribution->GetSumLL();
+            slidingNPoints += pFwdContribution->GetNPoints();
         }
 
-        const int bwdLayer(iLayer - layerFitHalfWindow - 1);
-        LayerFitContributionMap::const_iterator bwdIter = layerFitContributionMap.find(bwdLayer);
+        const LayerFitContribution *const pBwdContribution(getLayerFitContribution(iLayer - layerFitHalfWindow - 1));
 
-        if (layerFitContributionMap.end() != bwdIter)
+        if (pBwdContribution)
         {
-            slidingSumT -= bwdIter->second.GetSumT();
-            slidingSumL -= bwdIter->second.GetSumL();
-            slidingSumTT -= bwdIter->second.GetSumTT();
-            slidingSumLT -= bwdIter->second.GetSumLT();
-            slidingSumLL -= bwdIter->second.GetSumLL();
-            slidingNPoints -= bwdIter->second.GetNPoints();
+            slidingSumT -= pBwdContribution->GetSumT();
+            slidingSumL -= pBwdContribution->GetSumL();
+            slidingSumTT -= pBwdContribution->GetSumTT();
+            slidingSumLT -= pBwdContribution->GetSumLT();
+            slidingSumLL -= pBwdContribution->GetSumLL();
+            slidingNPoints -= pBwdContribution->GetNPoints();
         }
 
         // require three points for meaningful results
@@ -705,7 +741,7 @@ void TwoDSlidingFitResult::PerformSlidingLinearFit()
             continue;
 
         // only fill the result map if there is an entry in the contribution map
-        if (layerFitContributionMap.end() == layerFitContributionMap.find(iLayer))
+        if (!getLayerFitContribution(iLayer))
             continue;
 
         const double denominator(slidingSumLL - slidingSumL * slidingSumL / static_cast<double>(slidingNPoints));
@@ -732,7 +768,7 @@ void TwoDSlidingFitResult::PerformSlidingLinearFit()
         const double fitT(intercept + gradient * l);
 
         const LayerFitResult layerFitResult(l, fitT, gradient, rms);
-        (void)m_layerFitResultMap.insert(LayerFitResultMap::value_type(iLayer, layerFitResult));
+        (void)m_layerFitResultMap.emplace_hint(m_layerFitResultMap.end(), iLayer, layerFitResult);
     }
 
     if (m_layerFitResultMap.empty())
@@ -982,33 +1018,9 @@ StatusCode TwoDSlidingFitResult::GetLongitudinalSurroundingLayers(
     if ((startLayer < minLayer) || (startLayer >= maxLayer))
         return STATUS_CODE_NOT_FOUND;
 
-    // First layer iterator
-    firstLayerIter = m_layerFitResultMap.end();
-
-    for (int iLayer = startLayer; iLayer >= minLayer; --iLayer)
-    {
-        firstLayerIter = m_layerFitResultMap.find(iLayer);
-
-        if (m_layerFitResultMap.end() != firstLayerIter)
-            break;
-    }
-
-    if (m_layerFitResultMap.end() == firstLayerIter)
-        return STATUS_CODE_NOT_FOUND;
-
-    // Second layer iterator
-    secondLayerIter = m_layerFitResultMap.end();
-
-    for (int iLayer = startLayer + 1; iLayer <= maxLayer; ++iLayer)
-    {
-        secondLayerIter = m_layerFitResultMap.find(iLayer);
-
-        if (m_layerFitResultMap.end() != secondLayerIter)
-            break;
-    }
-
-    if (m_layerFitResultMap.end() == secondLayerIter)
-        return STATUS_CODE_NOT_FOUND;
+    // Surrounding layer iterators: the last layer at or below the start layer and the first layer above it, both within range
+    secondLayerIter = m_layerFitResultMap.upper_bound(startLayer);
+    firstLayerIter = std::prev(secondLayerIter);
 
     return STATUS_CODE_SUCCESS;
 }
@@ -1043,20 +1055,12 @@ StatusCode TwoDSlidingFitResult::GetTransverseSurroundingLayers(const float x, c
     const int startLayer(std::max(minLayer, std::min(maxLayer, this->GetLayer(startL))));
 
     // Find nearest layer iterator to start layer
-    LayerFitResultMap::const_iterator startLayerIter = m_layerFitResultMap.end();
-    CartesianVector startLayerPosition(0.f, 0.f, 0.f);
+    const LayerFitResultMap::const_iterator startLayerIter(m_layerFitResultMap.lower_bound(startLayer));
 
-    for (int iLayer = startLayer; iLayer <= maxLayer; ++iLayer)
-    {
-        startLayerIter = m_layerFitResultMap.find(iLayer);
-
-        if (m_layerFitResultMap.end() != startLayerIter)
-            break;
-    }
-
-    if (m_layerFitResultMap.end() == startLayerIter)
+    if ((m_layerFitResultMap.end() == startLayerIter) || (startLayerIter->first > maxLayer))
         return STATUS_CODE_NOT_FOUND;
 
+    CartesianVector startLayerPosition(0.f, 0.f, 0.f);
     this->GetGlobalPosition(startLayerIter->second.GetL(), startLayerIter->second.GetFitT(), startLayerPosition);
 
     const bool startIsAhead((startLayerPosition.GetX() - x) > std::numeric_limits<float>::epsilon());
@@ -1072,15 +1076,11 @@ StatusCode TwoDSlidingFitResult::GetTransverseSurroundingLayers(const float x, c
     CartesianVector firstLayerPosition(0.f, 0.f, 0.f);
     CartesianVector secondLayerPosition(0.f, 0.f, 0.f);
 
-    for (int iLayer = startLayerIter->first; (iLayer >= minLayer) && (iLayer <= maxLayer); iLayer += increment)
+    for (LayerFitResultMap::const_iterator iter = startLayerIter; (iter->first >= minLayer) && (iter->first <= maxLayer);)
     {
-        LayerFitResultMap::const_iterator tempIter = m_layerFitResultMap.find(iLayer);
-        if (m_layerFitResultMap.end() == tempIter)
-            continue;
-
         firstLayerIter = secondLayerIter;
         firstLayerPosition = secondLayerPosition;
-        secondLayerIter = tempIter;
+        secondLayerIter = iter;
 
         this->GetGlobalPosition(secondLayerIter->second.GetL(), secondLayerIter->second.GetFitT(), secondLayerPosition);
         const bool isAhead(secondLayerPosition.GetX() > x);
@@ -1089,6 +1089,20 @@ StatusCode TwoDSlidingFitResult::GetTransverseSurroundingLayers(const float x, c
             break;
 
         firstLayerIter = m_layerFitResultMap.end();
+
+        // Step to the next populated layer in the direction of the increment
+        if (increment > 0)
+        {
+            if (m_layerFitResultMap.end() == ++iter)
+                break;
+        }
+        else
+        {
+            if (m_layerFitResultMap.begin() == iter)
+                break;
+
+            --iter;
+        }
     }
 
     if (m_layerFitResultMap.end() == firstLayerIter || m_layerFitResultMap.end() == secondLayerIter)
@@ -32,6 +32,17 @@ TwoDSlidingShowerFitResult::TwoDSlidingShowerFitResult(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+TwoDSlidingShowerFitResult::TwoDSlidingShowerFitResult(
+    const T *const pT, const TwoDSlidingFitResult &showerFitResult, const float showerEdgeMultiplier) :
+    m_showerFitResult(showerFitResult),
+    m_negativeEdgeFitResult(TwoDSlidingShowerFitResult::LArTwoDShowerEdgeFit(pT, m_showerFitResult, NEGATIVE_SHOWER_EDGE, showerEdgeMultiplier)),
+    m_positiveEdgeFitResult(TwoDSlidingShowerFitResult::LArTwoDShowerEdgeFit(pT, m_showerFitResult, POSITIVE_SHOWER_EDGE, showerEdgeMultiplier))
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void TwoDSlidingShowerFitResult::GetShowerEdges(const float x, const bool widenIfAmbiguity, FloatVector &edgePositions) const
 {
     edgePositions.clear();
@@ -158,5 +169,7 @@ TwoDSlidingFitResult TwoDSlidingShowerFitResult::LArTwoDShowerEdgeFit(const Cart
 
 template TwoDSlidingShowerFitResult::TwoDSlidingShowerFitResult(const pandora::Cluster *const, const unsigned int, const float, const float);
 template TwoDSlidingShowerFitResult::TwoDSlidingShowerFitResult(const pandora::CartesianPointVector *const, const unsigned int, const float, const float);
+template TwoDSlidingShowerFitResult::TwoDSlidingShowerFitResult(const pandora::Cluster *const, const TwoDSlidingFitResult &, const float);
+template TwoDSlidingShowerFitResult::TwoDSlidingShowerFitResult(const pandora::CartesianPointVector *const, const TwoDSlidingFitResult &, const float);
 
 } // namespace lar_content
@@ -46,6 +46,16 @@ public:
     TwoDSlidingShowerFitResult(
         const T *const pT, const unsigned int slidingFitWindow, const float slidingFitLayerPitch, const float showerEdgeMultiplier = 1.f);
 
+    /**
+     *  @brief  Constructor using an existing sliding fit result for the full shower
+     *
+     *  @param  pT describing the positions to be fitted
+     *  @param  showerFitResult the sliding fit result for the full shower, made using the same positions
+     *  @param  showerEdgeMultiplier artificially tune width of shower envelope so as to make it more/less inclusive
+     */
+    template <typename T>
+    TwoDSlidingShowerFitResult(const T *const pT, const TwoDSlidingFitResult &showerFitResult, const float showerEdgeMultiplier = 1.f);
+
     /**
      *  @brief  Get the sliding fit result for the full shower cluster
      *
@@ -34,7 +34,7 @@ InitialRegionFeatureTool::InitialRegionFeatureTool() :
 
 void InitialRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
     const ParticleFlowObject *const /*pShowerPfo*/, const CartesianVector &nuVertex3D, const ProtoShowerMatch &protoShowerMatch,
-    const CartesianPointVector & /*showerStarts3D*/)
+    const CartesianPointVector & /*showerStarts3D*/, const ViewHitListMap & /*viewHitListMap*/)
 {
     float initialGapSizeU(m_defaultFloat), initialGapSizeV(m_defaultFloat), initialGapSizeW(m_defaultFloat);
     float largestGapSizeU(m_defaultFloat), largestGapSizeV(m_defaultFloat), largestGapSizeW(m_defaultFloat);
@@ -55,10 +55,10 @@ void InitialRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector
 
 void InitialRegionFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder, const std::string &featureToolName,
     const Algorithm *const pAlgorithm, const ParticleFlowObject *const pShowerPfo, const CartesianVector &nuVertex3D,
-    const ProtoShowerMatch &protoShowerMatch, const CartesianPointVector &showerStarts3D)
+    const ProtoShowerMatch &protoShowerMatch, const CartesianPointVector &showerStarts3D, const ViewHitListMap &viewHitListMap)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D);
+    this->Run(toolFeatureVec, pAlgorithm, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D, viewHitListMap);
 
     if (featureMap.find(featureToolName + "_initialGapSize") != featureMap.end())
     {
@@ -145,7 +145,7 @@ ConnectionRegionFeatureTool::ConnectionRegionFeatureTool() :
 
 void ConnectionRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
     const ParticleFlowObject *const /*pShowerPfo*/, const CartesianVector &nuVertex3D, const ProtoShowerMatch &protoShowerMatch,
-    const CartesianPointVector &showerStarts3D)
+    const CartesianPointVector &showerStarts3D, const ViewHitListMap & /*viewHitListMap*/)
 {
     const float pathwayLength = (nuVertex3D - showerStarts3D.front()).GetMagnitude();
     const float pathwayScatteringAngle2D = this->Get2DKink(pAlgorithm, protoShowerMatch, showerStarts3D.back());
@@ -158,10 +158,11 @@ void ConnectionRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVec
 
 void ConnectionRegionFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder,
     const std::string &featureToolName, const Algorithm *const pAlgorithm, const ParticleFlowObject *const pShowerPfo,
-    const CartesianVector &nuVertex3D, const ProtoShowerMatch &protoShowerMatch, const CartesianPointVector &showerStarts3D)
+    const CartesianVector &nuVertex3D, const ProtoShowerMatch &protoShowerMatch, const CartesianPointVector &showerStarts3D,
+    const ViewHitListMap &viewHitListMap)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D);
+    this->Run(toolFeatureVec, pAlgorithm, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D, viewHitListMap);
 
     if (featureMap.find(featureToolName + "_pathwayLength") != featureMap.end())
     {
@@ -353,7 +354,7 @@ ShowerRegionFeatureTool::ShowerRegionFeatureTool() :
 
 void ShowerRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
     const ParticleFlowObject *const pShowerPfo, const CartesianVector &nuVertex3D, const ProtoShowerMatch &protoShowerMatch,
-    const CartesianPointVector &showerStarts3D)
+    const CartesianPointVector &showerStarts3D, const ViewHitListMap & /*viewHitListMap*/)
 {
     float nHitsU(m_defaultFloat), foundHitRatioU(m_defaultRatio), scatterAngleU(m_defaultFloat), openingAngleU(m_defaultFloat),
         nuVertexEnergyAsymmetryU(m_defaultRatio), nuVertexEnergyWeightedMeanRadialDistanceU(m_defaultFloat),
@@ -419,10 +420,10 @@ void ShowerRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector,
 
 void ShowerRegionFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder, const std::string &featureToolName,
     const Algorithm *const pAlgorithm, const ParticleFlowObject *const pShowerPfo, const CartesianVector &nuVertex3D,
-    const ProtoShowerMatch &protoShowerMatch, const CartesianPointVector &showerStarts3D)
+    const ProtoShowerMatch &protoShowerMatch, const CartesianPointVector &showerStarts3D, const ViewHitListMap &viewHitListMap)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D);
+    this->Run(toolFeatureVec, pAlgorithm, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D, viewHitListMap);
 
     if (featureMap.find(featureToolName + "_nShowerHits") != featureMap.end())
     {
@@ -869,9 +870,6 @@ StatusCode ShowerRegionFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
 
 AmbiguousRegionFeatureTool::AmbiguousRegionFeatureTool() :
     m_defaultFloat(-10.f),
-    m_caloHitListNameU("CaloHitListU"),
-    m_caloHitListNameV("CaloHitListV"),
-    m_caloHitListNameW("CaloHitListW"),
     m_maxTransverseDistance(0.75f),
     m_maxSampleHits(3),
     m_maxHitSeparation(1.f),
@@ -883,7 +881,7 @@ AmbiguousRegionFeatureTool::AmbiguousRegionFeatureTool() :
 
 void AmbiguousRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const Algorithm *const pAlgorithm,
     const ParticleFlowObject *const /*pShowerPfo*/, const CartesianVector &nuVertex3D, const ProtoShowerMatch &protoShowerMatch,
-    const CartesianPointVector & /*showerStarts3D*/)
+    const CartesianPointVector & /*showerStarts3D*/, const ViewHitListMap &viewHitListMap)
 {
     float nAmbiguousViews(0.f);
     this->CalculateNAmbiguousViews(protoShowerMatch, nAmbiguousViews);
@@ -891,13 +889,13 @@ void AmbiguousRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVect
     float maxUnaccountedEnergy(m_defaultFloat);
     float unaccountedHitEnergyU(m_defaultFloat), unaccountedHitEnergyV(m_defaultFloat), unaccountedHitEnergyW(m_defaultFloat);
 
-    if (this->GetViewAmbiguousHitVariables(pAlgorithm, protoShowerMatch, TPC_VIEW_U, nuVertex3D, unaccountedHitEnergyU))
+    if (this->GetViewAmbiguousHitVariables(pAlgorithm, protoShowerMatch, TPC_VIEW_U, nuVertex3D, viewHitListMap, unaccountedHitEnergyU))
         maxUnaccountedEnergy = std::max(maxUnaccountedEnergy, unaccountedHitEnergyU);
 
-    if (this->GetViewAmbiguousHitVariables(pAlgorithm, protoShowerMatch, TPC_VIEW_V, nuVertex3D, unaccountedHitEnergyV))
+    if (this->GetViewAmbiguousHitVariables(pAlgorithm, protoShowerMatch, TPC_VIEW_V, nuVertex3D, viewHitListMap, unaccountedHitEnergyV))
         maxUnaccountedEnergy = std::max(maxUnaccountedEnergy, unaccountedHitEnergyV);
 
-    if (this->GetViewAmbiguousHitVariables(pAlgorithm, protoShowerMatch, TPC_VIEW_W, nuVertex3D, unaccountedHitEnergyW))
+    if (this->GetViewAmbiguousHitVariables(pAlgorithm, protoShowerMatch, TPC_VIEW_W, nuVertex3D, viewHitListMap, unaccountedHitEnergyW))
         maxUnaccountedEnergy = std::max(maxUnaccountedEnergy, unaccountedHitEnergyW);
 
     featureVector.push_back(nAmbiguousViews);
@@ -908,10 +906,11 @@ void AmbiguousRegionFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVect
 
 void AmbiguousRegionFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder,
     const std::string &featureToolName, const Algorithm *const pAlgorithm, const ParticleFlowObject *const pShowerPfo,
-    const CartesianVector &nuVertex3D, const ProtoShowerMatch &protoShowerMatch, const CartesianPointVector &showerStarts3D)
+    const CartesianVector &nuVertex3D, const ProtoShowerMatch &protoShowerMatch, const CartesianPointVector &showerStarts3D,
+    const ViewHitListMap &viewHitListMap)
 {
     LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D);
+    this->Run(toolFeatureVec, pAlgorithm, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D, viewHitListMap);
 
     if (featureMap.find(featureToolName + "_nAmbiguousViews") != featureMap.end())
     {
@@ -951,7 +950,7 @@ void AmbiguousRegionFeatureTool::CalculateNAmbiguousViews(const ProtoShowerMatch
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 bool AmbiguousRegionFeatureTool::GetViewAmbiguousHitVariables(const Algorithm *const pAlgorithm, const ProtoShowerMatch &protoShowerMatch,
-    const HitType hitType, const CartesianVector &nuVertex3D, float &unaccountedHitEnergy)
+    const HitType hitType, const CartesianVector &nuVertex3D, const ViewHitListMap &viewHitListMap, float &unaccountedHitEnergy)
 {
     std::map<int, CaloHitList> ambiguousHitSpines;
     CaloHitList hitsToExcludeInEnergyCalcs; // to avoid double  counting
@@ -960,7 +959,7 @@ bool AmbiguousRegionFeatureTool::GetViewAmbiguousHitVariables(const Algorithm *c
             ? protoShowerMatch.GetProtoShowerU()
             : (hitType == TPC_VIEW_V ? protoShowerMatch.GetProtoShowerV() : protoShowerMatch.GetProtoShowerW()));
 
-    this->BuildAmbiguousSpines(pAlgorithm, hitType, protoShower, nuVertex2D, ambiguousHitSpines, hitsToExcludeInEnergyCalcs);
+    this->BuildAmbiguousSpines(viewHitListMap, hitType, protoShower, nuVertex2D, ambiguousHitSpines, hitsToExcludeInEnergyCalcs);
 
     if (ambiguousHitSpines.empty())
         return false;
@@ -1037,14 +1036,17 @@ bool AmbiguousRegionFeatureTool::GetViewAmbiguousHitVariables(const Algorithm *c
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void AmbiguousRegionFeatureTool::BuildAmbiguousSpines(const Algorithm *const pAlgorithm, const HitType hitType, const ProtoShower &protoShower,
-    const CartesianVector &nuVertex2D, std::map<int, CaloHitList> &ambiguousHitSpines, CaloHitList &hitsToExcludeInEnergyCalcs)
+void AmbiguousRegionFeatureTool::BuildAmbiguousSpines(const ViewHitListMap &viewHitListMap, const HitType hitType,
+    const ProtoShower &protoShower, const CartesianVector &nuVertex2D, std::map<int, CaloHitList> &ambiguousHitSpines,
+    CaloHitList &hitsToExcludeInEnergyCalcs)
 {
-    const CaloHitList *pCaloHitList;
+    const ViewHitListMap::const_iterator viewIter(viewHitListMap.find(hitType));
 
-    if (this->GetHitListOfType(pAlgorithm, hitType, pCaloHitList) != STATUS_CODE_SUCCESS)
+    if (viewHitListMap.end() == viewIter)
         return;
 
+    const CaloHitList *const pCaloHitList(viewIter->second);
+
     std::map<int, CaloHitList> ambiguousHitSpinesTemp;
 
     for (const CaloHit *const pCaloHit : *pCaloHitList)
@@ -1089,23 +1091,6 @@ void AmbiguousRegionFeatureTool::BuildAmbiguousSpines(const Algorithm *const pAl
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode AmbiguousRegionFeatureTool::GetHitListOfType(const Algorithm *const pAlgorithm, const HitType hitType, const CaloHitList *&pCaloHitList) const
-{
-    const std::string typeHitListName(hitType == TPC_VIEW_U ? m_caloHitListNameU
-            : hitType == TPC_VIEW_V                         ? m_caloHitListNameV
-                                                            : m_caloHitListNameW);
-
-    PANDORA_THROW_RESULT_IF_AND_IF(
-        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=, PandoraContentApi::GetList(*pAlgorithm, typeHitListName, pCaloHitList));
-
-    if (!pCaloHitList || pCaloHitList->empty())
-        return STATUS_CODE_NOT_INITIALIZED;
-
-    return STATUS_CODE_SUCCESS;
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
 CaloHitList AmbiguousRegionFeatureTool::FindAmbiguousContinuousSpine(
     const CaloHitList &caloHitList, const CaloHitList &ambiguousHitList, const CartesianVector &nuVertex2D)
 {
@@ -1165,15 +1150,6 @@ StatusCode AmbiguousRegionFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "DefaultFloat", m_defaultFloat));
 
-    PANDORA_RETURN_RESULT_IF_AND_IF(
-        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "CaloHitListNameU", m_caloHitListNameU));
-
-    PANDORA_RETURN_RESULT_IF_AND_IF(
-        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "CaloHitListNameV", m_caloHitListNameV));
-
-    PANDORA_RETURN_RESULT_IF_AND_IF(
-        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "CaloHitListNameW", m_caloHitListNameW));
-
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxTransverseDistance", m_maxTransverseDistance));
 
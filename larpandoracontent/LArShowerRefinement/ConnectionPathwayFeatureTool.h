@@ -19,7 +19,9 @@
 namespace lar_content
 {
 
-typedef MvaFeatureTool<const pandora::Algorithm *const, const pandora::ParticleFlowObject *const, const pandora::CartesianVector &, const ProtoShowerMatch &, const pandora::CartesianPointVector &> ConnectionPathwayFeatureTool;
+typedef std::map<pandora::HitType, const pandora::CaloHitList *> ViewHitListMap; ///< Map of event view hit lists for passing to tools
+
+typedef MvaFeatureTool<const pandora::Algorithm *const, const pandora::ParticleFlowObject *const, const pandora::CartesianVector &, const ProtoShowerMatch &, const pandora::CartesianPointVector &, const ViewHitListMap &> ConnectionPathwayFeatureTool;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -36,11 +38,13 @@ public:
 
     void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
         const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D);
+        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D,
+        const ViewHitListMap &viewHitListMap);
 
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
         const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D);
+        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D,
+        const ViewHitListMap &viewHitListMap);
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -79,11 +83,13 @@ public:
 
     void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
         const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D);
+        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D,
+        const ViewHitListMap &viewHitListMap);
 
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
         const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D);
+        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D,
+        const ViewHitListMap &viewHitListMap);
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -135,11 +141,13 @@ public:
 
     void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
         const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D);
+        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D,
+        const ViewHitListMap &viewHitListMap);
 
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
         const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D);
+        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D,
+        const ViewHitListMap &viewHitListMap);
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -275,11 +283,13 @@ public:
 
     void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm,
         const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D);
+        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D,
+        const ViewHitListMap &viewHitListMap);
 
     void Run(LArMvaHelper::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName,
         const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D);
+        const ProtoShowerMatch &protoShowerMatch, const pandora::CartesianPointVector &showerStarts3D,
+        const ViewHitListMap &viewHitListMap);
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -299,39 +309,29 @@ private:
      *  @param  protoShowerMatch the ProtoShower match
      *  @param  hitType the 2D view
      *  @param  nuVertex3D the 3D neutrino vertex
+     *  @param  viewHitListMap the event hit lists of each view
      *  @param  unaccountedHitEnergy the output unaccounted hit energy
      *
      *  @return whether the ambiguous region variables could be calculated
      */
     bool GetViewAmbiguousHitVariables(const pandora::Algorithm *const pAlgorithm, const ProtoShowerMatch &protoShowerMatch,
-        const pandora::HitType hitType, const pandora::CartesianVector &nuVertex3D, float &unaccountedHitEnergy);
+        const pandora::HitType hitType, const pandora::CartesianVector &nuVertex3D, const ViewHitListMap &viewHitListMap,
+        float &unaccountedHitEnergy);
 
     /**
      *  @brief  Determine the spine hits of the particles with which the ambiguous hits are shared
      *
-     *  @param  pAlgorithm the algorithm
+     *  @param  viewHitListMap the event hit lists of each view
      *  @param  hitType the 2D view
      *  @param  protoShower the ProtoShower
      *  @param  nuVertex2D the 2D neutrino vertex
      *  @param  ambiguousHitSpines the output [particle index -> shower spine hits] map
      *  @param  hitsToExcludeInEnergyCalcs the list of hits to exclude in energy calculations
      */
-    void BuildAmbiguousSpines(const pandora::Algorithm *const pAlgorithm, const pandora::HitType hitType, const ProtoShower &protoShower,
+    void BuildAmbiguousSpines(const ViewHitListMap &viewHitListMap, const pandora::HitType hitType, const ProtoShower &protoShower,
         const pandora::CartesianVector &nuVertex2D, std::map<int, pandora::CaloHitList> &ambiguousHitSpines,
         pandora::CaloHitList &hitsToExcludeInEnergyCalcs);
 
-    /**
-     *  @brief  Obtain the event hit list of a given view
-     *
-     *  @param  pAlgorithm the algorithm
-     *  @param  hitType the 2D view
-     *  @param  pCaloHitList the output 2D hit list
-     *
-     *  @return whether a valid 2D hit list could be found
-     */
-    pandora::StatusCode GetHitListOfType(
-        const pandora::Algorithm *const pAlgorithm, const pandora::HitType hitType, const pandora::CaloHitList *&pCaloHitList) const;
-
     /**
      *  @brief  Determine a continuous pathway of an ambigous particle's spine hits
      *
@@ -344,12 +344,9 @@ private:
     pandora::CaloHitList FindAmbiguousContinuousSpine(
         const pandora::CaloHitList &caloHitList, const pandora::CaloHitList &ambiguousHitList, const pandora::CartesianVector &nuVertex2D);
 
-    float m_defaultFloat;           ///< Default float value
-    std::string m_caloHitListNameU; ///< The event U view hit list
-    std::string m_caloHitListNameV; ///< The event V view hit list
-    std::string m_caloHitListNameW; ///< The event W view hit list
-    float m_maxTransverseDistance;  ///< The max. proximity of a hits, included in a trajectory energy calcs.
-    unsigned int m_maxSampleHits;   ///< The max. number of hits considered in the spine energy calcs.
+    float m_defaultFloat;          ///< Default float value
+    float m_maxTransverseDistance; ///< The max. proximity of a hits, included in a trajectory energy calcs.
+    unsigned int m_maxSampleHits;  ///< The max. number of hits considered in the spine energy calcs.
     float m_maxHitSeparation;       ///< The max. separation of connected hits
     float m_maxTrackFraction;       ///< The fraction of found hits which are considered in the energy calcs.
 };
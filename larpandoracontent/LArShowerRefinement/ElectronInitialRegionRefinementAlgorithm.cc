@@ -16,6 +16,7 @@
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
 
 #include "larpandoracontent/LArShowerRefinement/ElectronInitialRegionRefinementAlgorithm.h"
 #include "larpandoracontent/LArShowerRefinement/LArProtoShower.h"
@@ -24,6 +25,8 @@
 #include "larpandoracontent/LArShowerRefinement/ShowerSpineFinderTool.h"
 #include "larpandoracontent/LArShowerRefinement/ShowerStartFinderTool.h"
 
+#include <exception>
+
 using namespace pandora;
 
 namespace lar_content
@@ -43,7 +46,8 @@ ElectronInitialRegionRefinementAlgorithm::ElectronInitialRegionRefinementAlgorit
     m_minElectronPurity(0.5f),
     m_maxSeparationFromHit(3.f),
     m_maxProjectionSeparation(5.f),
-    m_maxXSeparation(0.5f)
+    m_maxXSeparation(0.5f),
+    m_nShowerThreads(1)
 {
 }
 
@@ -57,16 +61,63 @@ StatusCode ElectronInitialRegionRefinementAlgorithm::Run()
     if (showerPfoVector.empty())
         return STATUS_CODE_SUCCESS;
 
+    // Only consider significant showers
+    PfoVector significantShowerPfoVector;
+
     for (const ParticleFlowObject *const pShowerPfo : showerPfoVector)
     {
-        // Only consider significant showers
         CaloHitList caloHits3D;
         LArPfoHelper::GetCaloHits(pShowerPfo, TPC_3D, caloHits3D);
 
-        if (caloHits3D.size() < m_minShowerHits3D)
-            continue;
+        if (caloHits3D.size() >= m_minShowerHits3D)
+            significantShowerPfoVector.push_back(pShowerPfo);
+    }
+
+    if (significantShowerPfoVector.empty())
+        return STATUS_CODE_SUCCESS;
+
+    CartesianVector nuVertex3D(0.f, 0.f, 0.f);
+
+    if (this->GetNeutrinoVertex(nuVertex3D) != STATUS_CODE_SUCCESS)
+        return STATUS_CODE_SUCCESS;
+
+    // ATTN The event hit lists are fetched here, serially, so that the concurrent pathway feature calculations never access list managers
+    ViewHitListMap viewHitListMap;
+
+    for (const HitType hitType : {TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W})
+    {
+        const CaloHitList *pViewHitList(nullptr);
+
+        if (this->GetHitListOfType(hitType, pViewHitList) == STATUS_CODE_SUCCESS)
+            viewHitListMap[hitType] = pViewHitList;
+    }
+
+    // Pathway features for each shower are calculated into their own slot, then the shower pfos are modified serially, in shower order
+    const unsigned int nShowers(significantShowerPfoVector.size());
+    std::vector<PathwayFeaturesVector> pathwayFeaturesVectors(nShowers);
+    std::vector<std::exception_ptr> showerExceptions(nShowers);
+
+    LArThreadingHelper::RunTasks(LArThreadingHelper::GetNThreads(m_nShowerThreads, nShowers), nShowers,
+        [&](const unsigned int, const unsigned int showerIndex)
+        {
+            try
+            {
+                const ParticleFlowObject *const pShowerPfo(significantShowerPfoVector.at(showerIndex));
+                this->CalculatePathwayFeatures(pShowerPfo, nuVertex3D, viewHitListMap, pathwayFeaturesVectors.at(showerIndex));
+            }
+            catch (...)
+            {
+                // ATTN Rethrown in shower order, so that the preceding showers are still refined
+                showerExceptions.at(showerIndex) = std::current_exception();
+            }
+        });
+
+    for (unsigned int showerIndex = 0; showerIndex < nShowers; ++showerIndex)
+    {
+        if (showerExceptions.at(showerIndex))
+            std::rethrow_exception(showerExceptions.at(showerIndex));
 
-        this->RefineShower(pShowerPfo);
+        this->ApplyPathwayFeatures(significantShowerPfoVector.at(showerIndex), pathwayFeaturesVectors.at(showerIndex));
     }
 
     return STATUS_CODE_SUCCESS;
@@ -94,35 +145,31 @@ void ElectronInitialRegionRefinementAlgorithm::FillShowerPfoVector(PfoVector &sh
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ElectronInitialRegionRefinementAlgorithm::RefineShower(const ParticleFlowObject *const pShowerPfo) const
+void ElectronInitialRegionRefinementAlgorithm::CalculatePathwayFeatures(const ParticleFlowObject *const pShowerPfo,
+    const CartesianVector &nuVertex3D, const ViewHitListMap &viewHitListMap, PathwayFeaturesVector &pathwayFeaturesVector) const
 {
-    CartesianVector nuVertex3D(0.f, 0.f, 0.f);
-
-    if (this->GetNeutrinoVertex(nuVertex3D) != STATUS_CODE_SUCCESS)
-        return;
-
     // Create the 2D connetion pathways
     ProtoShowerVector protoShowerVectorU, protoShowerVectorV, protoShowerVectorW;
 
-    this->BuildViewProtoShowers(pShowerPfo, nuVertex3D, TPC_VIEW_U, protoShowerVectorU);
-    this->BuildViewProtoShowers(pShowerPfo, nuVertex3D, TPC_VIEW_V, protoShowerVectorV);
-    this->BuildViewProtoShowers(pShowerPfo, nuVertex3D, TPC_VIEW_W, protoShowerVectorW);
+    this->BuildViewProtoShowers(pShowerPfo, nuVertex3D, viewHitListMap, TPC_VIEW_U, protoShowerVectorU);
+    this->BuildViewProtoShowers(pShowerPfo, nuVertex3D, viewHitListMap, TPC_VIEW_V, protoShowerVectorV);
+    this->BuildViewProtoShowers(pShowerPfo, nuVertex3D, viewHitListMap, TPC_VIEW_W, protoShowerVectorW);
 
     // 2D->3D connection pathway matching
     ProtoShowerMatchVector protoShowerMatchVector;
     m_pProtoShowerMatchingTool->Run(protoShowerVectorU, protoShowerVectorV, protoShowerVectorW, protoShowerMatchVector);
 
-    if (protoShowerMatchVector.empty())
-        return;
-
     for (ProtoShowerMatch &protoShowerMatch : protoShowerMatchVector)
     {
         // Remove ambiguous hits from hits to add list
         ConnectionPathwayVector viewPathwaysU, viewPathwaysV, viewPathwaysW;
 
-        this->BuildViewPathways(pShowerPfo, protoShowerMatch.GetProtoShowerU().GetSpineHitList(), nuVertex3D, TPC_VIEW_U, viewPathwaysU);
-        this->BuildViewPathways(pShowerPfo, protoShowerMatch.GetProtoShowerV().GetSpineHitList(), nuVertex3D, TPC_VIEW_V, viewPathwaysV);
-        this->BuildViewPathways(pShowerPfo, protoShowerMatch.GetProtoShowerW().GetSpineHitList(), nuVertex3D, TPC_VIEW_W, viewPathwaysW);
+        this->BuildViewPathways(
+            pShowerPfo, protoShowerMatch.GetProtoShowerU().GetSpineHitList(), nuVertex3D, viewHitListMap, TPC_VIEW_U, viewPathwaysU);
+        this->BuildViewPathways(
+            pShowerPfo, protoShowerMatch.GetProtoShowerV().GetSpineHitList(), nuVertex3D, viewHitListMap, TPC_VIEW_V, viewPathwaysV);
+        this->BuildViewPathways(
+            pShowerPfo, protoShowerMatch.GetProtoShowerW().GetSpineHitList(), nuVertex3D, viewHitListMap, TPC_VIEW_W, viewPathwaysW);
 
         this->RefineHitsToAdd(nuVertex3D, TPC_VIEW_U, viewPathwaysU, protoShowerMatch.GetProtoShowerToModify(TPC_VIEW_U));
         this->RefineHitsToAdd(nuVertex3D, TPC_VIEW_V, viewPathwaysV, protoShowerMatch.GetProtoShowerToModify(TPC_VIEW_V));
@@ -137,11 +184,26 @@ void ElectronInitialRegionRefinementAlgorithm::RefineShower(const ParticleFlowOb
         }
 
         // Fill BDT information
-        StringVector featureOrder;
-        const LArMvaHelper::MvaFeatureMap featureMap(LArMvaHelper::CalculateFeatures(
-            m_algorithmToolNames, m_featureToolMap, featureOrder, this, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D));
+        PathwayFeatures pathwayFeatures;
+        pathwayFeatures.m_featureMap = LArMvaHelper::CalculateFeatures(m_algorithmToolNames, m_featureToolMap,
+            pathwayFeatures.m_featureOrder, this, pShowerPfo, nuVertex3D, protoShowerMatch, showerStarts3D, viewHitListMap);
 
-        this->SetMetadata(pShowerPfo, featureMap);
+        pathwayFeaturesVector.push_back(std::move(pathwayFeatures));
+
+        // ATTN Only the first characterised pathway is used in training mode
+        if (m_trainingMode)
+            break;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ElectronInitialRegionRefinementAlgorithm::ApplyPathwayFeatures(
+    const ParticleFlowObject *const pShowerPfo, const PathwayFeaturesVector &pathwayFeaturesVector) const
+{
+    for (const PathwayFeatures &pathwayFeatures : pathwayFeaturesVector)
+    {
+        this->SetMetadata(pShowerPfo, pathwayFeatures.m_featureMap);
 
         if (m_trainingMode)
         {
@@ -149,13 +211,9 @@ void ElectronInitialRegionRefinementAlgorithm::RefineShower(const ParticleFlowOb
             HitOwnershipMap electronHitMap;
             this->FillElectronHitMap(electronHitMap);
 
-            if (this->IsElectron(pShowerPfo, electronHitMap))
-            {
-                LArMvaHelper::ProduceTrainingExample(m_trainingFileName, true, featureOrder, featureMap);
-                break;
-            }
-
-            LArMvaHelper::ProduceTrainingExample(m_trainingFileName, false, featureOrder, featureMap);
+            const bool isElectron(this->IsElectron(pShowerPfo, electronHitMap));
+            LArMvaHelper::ProduceTrainingExample(
+                m_trainingFileName, isElectron, pathwayFeatures.m_featureOrder, pathwayFeatures.m_featureMap);
 
             break;
         }
@@ -189,13 +247,15 @@ StatusCode ElectronInitialRegionRefinementAlgorithm::GetNeutrinoVertex(Cartesian
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ElectronInitialRegionRefinementAlgorithm::BuildViewProtoShowers(const ParticleFlowObject *const pShowerPfo,
-    const CartesianVector &nuVertex3D, HitType hitType, ProtoShowerVector &protoShowerVector) const
+    const CartesianVector &nuVertex3D, const ViewHitListMap &viewHitListMap, HitType hitType, ProtoShowerVector &protoShowerVector) const
 {
-    const CaloHitList *pViewHitList(nullptr);
+    const ViewHitListMap::const_iterator viewIter(viewHitListMap.find(hitType));
 
-    if (this->GetHitListOfType(hitType, pViewHitList) != STATUS_CODE_SUCCESS)
+    if (viewHitListMap.end() == viewIter)
         return;
 
+    const CaloHitList *const pViewHitList(viewIter->second);
+
     CartesianVector showerVertexPosition(0.f, 0.f, 0.f);
     try
     {
@@ -402,13 +462,16 @@ bool ElectronInitialRegionRefinementAlgorithm::IsSpineCoincident(const ParticleF
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ElectronInitialRegionRefinementAlgorithm::BuildViewPathways(const ParticleFlowObject *const pShowerPfo,
-    const CaloHitList &protectedHits, const CartesianVector &nuVertex3D, HitType hitType, ConnectionPathwayVector &viewPathways) const
+    const CaloHitList &protectedHits, const CartesianVector &nuVertex3D, const ViewHitListMap &viewHitListMap, HitType hitType,
+    ConnectionPathwayVector &viewPathways) const
 {
-    const CaloHitList *pViewHitList(nullptr);
+    const ViewHitListMap::const_iterator viewIter(viewHitListMap.find(hitType));
 
-    if (this->GetHitListOfType(hitType, pViewHitList) != STATUS_CODE_SUCCESS)
+    if (viewHitListMap.end() == viewIter)
         return;
 
+    const CaloHitList *const pViewHitList(viewIter->second);
+
     // Get the peak direction vector
     CartesianPointVector eventPeakDirectionVector;
     m_pEventPeakDirectionFinderTool->Run(pShowerPfo, nuVertex3D, pViewHitList, hitType, eventPeakDirectionVector);
@@ -759,6 +822,9 @@ StatusCode ElectronInitialRegionRefinementAlgorithm::ReadSettings(const TiXmlHan
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxXSeparation", m_maxXSeparation));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NShowerThreads", m_nShowerThreads));
+
     AlgorithmToolVector algorithmToolVector;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ProcessAlgorithmToolList(*this, xmlHandle, "FeatureTools", algorithmToolVector));
 
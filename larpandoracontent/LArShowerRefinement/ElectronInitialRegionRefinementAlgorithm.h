@@ -17,6 +17,8 @@
 #include "larpandoracontent/LArShowerRefinement/ShowerSpineFinderTool.h"
 #include "larpandoracontent/LArShowerRefinement/ShowerStartFinderTool.h"
 
+#include <vector>
+
 namespace lar_content
 {
 
@@ -32,6 +34,17 @@ public:
     ElectronInitialRegionRefinementAlgorithm();
 
 private:
+    /**
+     *  @brief  PathwayFeatures class, holding the characterisation of a matched shower connection pathway
+     */
+    class PathwayFeatures
+    {
+    public:
+        pandora::StringVector m_featureOrder;     ///< The order in which the features were calculated
+        LArMvaHelper::MvaFeatureMap m_featureMap; ///< The map of [characterisation variable -> value]
+    };
+
+    typedef std::vector<PathwayFeatures> PathwayFeaturesVector;
     typedef std::map<const pandora::MCParticle *, pandora::CaloHitList> HitOwnershipMap;
 
     pandora::StatusCode Run();
@@ -45,11 +58,24 @@ private:
     void FillShowerPfoVector(pandora::PfoVector &showerPfoVector) const;
 
     /**
-     *  @brief  Find and evaluate shower connection pathway, removing if necessary
+     *  @brief  Find the shower connection pathways and calculate their features, without modifying the shower pfo
+     *
+     *  @param  pShowerPfo the input shower pfo
+     *  @param  nuVertex3D the 3D neutrino vertex
+     *  @param  viewHitListMap the event hit lists of each view
+     *  @param  pathwayFeaturesVector the output vector of pathway features, in pathway evaluation order
+     */
+    void CalculatePathwayFeatures(const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
+        const ViewHitListMap &viewHitListMap, PathwayFeaturesVector &pathwayFeaturesVector) const;
+
+    /**
+     *  @brief  Evaluate the shower connection pathways, adding their characterisation to the shower pfo (and writing training examples)
      *
      *  @param  pShowerPfo the input shower pfo
+     *  @param  pathwayFeaturesVector the vector of pathway features, in pathway evaluation order
      */
-    void RefineShower(const pandora::ParticleFlowObject *const pShowerPfo) const;
+    void ApplyPathwayFeatures(
+        const pandora::ParticleFlowObject *const pShowerPfo, const PathwayFeaturesVector &pathwayFeaturesVector) const;
 
     /**
      *  @brief  Obtain the reconstructed neutrino vertex
@@ -65,11 +91,12 @@ private:
      *
      *  @param  pShowerPfo the input shower pfo
      *  @param  nuVertex3D the 3D neutrino vertex
+     *  @param  viewHitListMap the event hit lists of each view
      *  @param  hitType the 2D view
      *  @param  protoShowerVector the output vector of ProtoShower objects
      */
     void BuildViewProtoShowers(const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CartesianVector &nuVertex3D,
-        pandora::HitType hitType, ProtoShowerVector &protoShowerVector) const;
+        const ViewHitListMap &viewHitListMap, pandora::HitType hitType, ProtoShowerVector &protoShowerVector) const;
 
     /**
      *  @brief  Obtain the event hit list of a given view
@@ -137,11 +164,13 @@ private:
      *  @param  pShowerPfo the input shower pfo
      *  @param  protectedHits the list of protected hits which will not be considered
      *  @param  nuVertex3D the 3D neutrino vertex
+     *  @param  viewHitListMap the event hit lists of each view
      *  @param  hitType the 2D view
      *  @param  viewPathways the output vector of found connection pathways
      */
     void BuildViewPathways(const pandora::ParticleFlowObject *const pShowerPfo, const pandora::CaloHitList &protectedHits,
-        const pandora::CartesianVector &nuVertex3D, pandora::HitType hitType, ConnectionPathwayVector &viewPathways) const;
+        const pandora::CartesianVector &nuVertex3D, const ViewHitListMap &viewHitListMap, pandora::HitType hitType,
+        ConnectionPathwayVector &viewPathways) const;
 
     /**
      *  @brief  Determine the continuous and unambiguous hits to add to an electron-like shower pfo
@@ -214,6 +243,7 @@ private:
     float m_maxXSeparation;           ///< The max. drift-coordinate separation between a 3D shower start and a matched 2D shower hit
     ConnectionPathwayFeatureTool::FeatureToolMap m_featureToolMap; ///< The feature tool map
     pandora::StringVector m_algorithmToolNames;                    ///< The algorithm tool names
+    unsigned int m_nShowerThreads; ///< The number of threads used to calculate shower pathway features (zero for hardware concurrency)
 };
 
 } // namespace lar_content
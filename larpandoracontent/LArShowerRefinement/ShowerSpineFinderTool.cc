@@ -17,6 +17,10 @@
 
 #include "larpandoracontent/LArShowerRefinement/ShowerSpineFinderTool.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 using namespace pandora;
 
 namespace lar_content
@@ -32,7 +36,8 @@ ShowerSpineFinderTool::ShowerSpineFinderTool() :
     m_growingFitSegmentLength(5.f),
     m_highResolutionSlidingFitWindow(5),
     m_distanceToLine(0.75f),
-    m_hitConnectionDistance(0.75f)
+    m_hitConnectionDistance(0.75f),
+    m_searchGridCellSize(2.f)
 {
 }
 
@@ -57,6 +62,13 @@ StatusCode ShowerSpineFinderTool::Run(const CartesianVector &nuVertex3D, const C
 void ShowerSpineFinderTool::FindShowerSpine(const CaloHitList *const pViewHitList, const CartesianVector &nuVertex2D,
     const CartesianVector &initialDirection, CaloHitList &unavailableHitList, CaloHitList &showerSpineHitList) const
 {
+    const CaloHitSet unavailableHitSet(unavailableHitList.begin(), unavailableHitList.end());
+    CaloHitSet showerSpineHitSet(showerSpineHitList.begin(), showerSpineHitList.end());
+    CaloHitGrid showerSpineHitGrid(m_searchGridCellSize);
+
+    for (const CaloHit *const pCaloHit : showerSpineHitList)
+        showerSpineHitGrid.Insert(pCaloHit);
+
     // Use initial direction to find seed hits for a starting fit
     float highestL(0.f);
     CartesianPointVector runningFitPositionVector;
@@ -73,9 +85,9 @@ void ShowerSpineFinderTool::FindShowerSpine(const CaloHitList *const pViewHitLis
             if (l > highestL)
                 highestL = l;
 
-            if (std::find(unavailableHitList.begin(), unavailableHitList.end(), pCaloHit) == unavailableHitList.end())
+            if (!unavailableHitSet.count(pCaloHit))
             {
-                showerSpineHitList.push_back(pCaloHit);
+                this->AddToShowerSpine(pCaloHit, showerSpineHitSet, showerSpineHitGrid, showerSpineHitList);
             }
 
             runningFitPositionVector.push_back(hitPosition);
@@ -89,6 +101,12 @@ void ShowerSpineFinderTool::FindShowerSpine(const CaloHitList *const pViewHitLis
         return;
     }
 
+    // Index the event hits, so that each running fit step need only consider those near the shower spine projection
+    CaloHitGrid viewHitGrid(m_searchGridCellSize);
+
+    for (const CaloHit *const pCaloHit : *pViewHitList)
+        viewHitGrid.Insert(pCaloHit);
+
     // Perform a running fit to collect a pathway of hits
     unsigned int count(0);
     bool hitsCollected(true);
@@ -125,7 +143,8 @@ void ShowerSpineFinderTool::FindShowerSpine(const CaloHitList *const pViewHitLis
             extrapolatedEndPosition = extrapolatedStartPosition + (extrapolatedDirection * m_growingFitSegmentLength);
 
             hitsCollected = this->CollectSubsectionHits(extrapolatedFit, extrapolatedStartPosition, extrapolatedEndPosition,
-                extrapolatedDirection, isEndDownstream, pViewHitList, runningFitPositionVector, unavailableHitList, showerSpineHitList);
+                extrapolatedDirection, isEndDownstream, viewHitGrid, unavailableHitSet, runningFitPositionVector, showerSpineHitSet,
+                showerSpineHitGrid, showerSpineHitList);
 
             // If no hits found, as a final effort, reduce the sliding fit window
             if (!hitsCollected)
@@ -140,7 +159,8 @@ void ShowerSpineFinderTool::FindShowerSpine(const CaloHitList *const pViewHitLis
                 extrapolatedEndPosition = extrapolatedStartPosition + (extrapolatedDirection * m_growingFitSegmentLength);
 
                 hitsCollected = this->CollectSubsectionHits(microExtrapolatedFit, extrapolatedStartPosition, extrapolatedEndPosition,
-                    extrapolatedDirection, isEndDownstream, pViewHitList, runningFitPositionVector, unavailableHitList, showerSpineHitList);
+                    extrapolatedDirection, isEndDownstream, viewHitGrid, unavailableHitSet, runningFitPositionVector, showerSpineHitSet,
+                    showerSpineHitGrid, showerSpineHitList);
             }
         }
         catch (const StatusCodeException &)
@@ -154,8 +174,9 @@ void ShowerSpineFinderTool::FindShowerSpine(const CaloHitList *const pViewHitLis
 
 bool ShowerSpineFinderTool::CollectSubsectionHits(const TwoDSlidingFitResult &extrapolatedFit,
     const CartesianVector &extrapolatedStartPosition, const CartesianVector &extrapolatedEndPosition,
-    const CartesianVector &extrapolatedDirection, const bool isEndDownstream, const CaloHitList *const pViewHitList,
-    CartesianPointVector &runningFitPositionVector, CaloHitList &unavailableHitList, CaloHitList &showerSpineHitList) const
+    const CartesianVector &extrapolatedDirection, const bool isEndDownstream, const CaloHitGrid &viewHitGrid,
+    const CaloHitSet &unavailableHitSet, CartesianPointVector &runningFitPositionVector, CaloHitSet &showerSpineHitSet,
+    CaloHitGrid &showerSpineHitGrid, CaloHitList &showerSpineHitList) const
 {
     float extrapolatedStartL(0.f), extrapolatedStartT(0.f);
     extrapolatedFit.GetLocalPosition(extrapolatedStartPosition, extrapolatedStartL, extrapolatedStartT);
@@ -163,14 +184,18 @@ bool ShowerSpineFinderTool::CollectSubsectionHits(const TwoDSlidingFitResult &ex
     float extrapolatedEndL(0.f), extrapolatedEndT(0.f);
     extrapolatedFit.GetLocalPosition(extrapolatedEndPosition, extrapolatedEndL, extrapolatedEndT);
 
+    CaloHitVector candidateHits;
+    this->FindCandidateHits(extrapolatedFit, extrapolatedStartL, extrapolatedEndL, extrapolatedStartPosition, extrapolatedDirection,
+        viewHitGrid, candidateHits);
+
     CaloHitList collectedHits;
 
-    for (const CaloHit *const pCaloHit : *pViewHitList)
+    for (const CaloHit *const pCaloHit : candidateHits)
     {
-        if (std::find(showerSpineHitList.begin(), showerSpineHitList.end(), pCaloHit) != showerSpineHitList.end())
+        if (showerSpineHitSet.count(pCaloHit))
             continue;
 
-        if (std::find(unavailableHitList.begin(), unavailableHitList.end(), pCaloHit) != unavailableHitList.end())
+        if (unavailableHitSet.count(pCaloHit))
             continue;
 
         const CartesianVector &hitPosition(pCaloHit->GetPositionVector());
@@ -203,7 +228,8 @@ bool ShowerSpineFinderTool::CollectSubsectionHits(const TwoDSlidingFitResult &ex
     const int nInitialHits(showerSpineHitList.size());
 
     // Now find a continuous path of collected hits
-    this->CollectConnectedHits(collectedHits, extrapolatedStartPosition, extrapolatedDirection, runningFitPositionVector, showerSpineHitList);
+    this->CollectConnectedHits(collectedHits, extrapolatedStartPosition, extrapolatedDirection, runningFitPositionVector, showerSpineHitSet,
+        showerSpineHitGrid, showerSpineHitList);
 
     const int nFinalHits(showerSpineHitList.size());
 
@@ -212,6 +238,57 @@ bool ShowerSpineFinderTool::CollectSubsectionHits(const TwoDSlidingFitResult &ex
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ShowerSpineFinderTool::FindCandidateHits(const TwoDSlidingFitResult &extrapolatedFit, const float extrapolatedStartL,
+    const float extrapolatedEndL, const CartesianVector &extrapolatedStartPosition, const CartesianVector &extrapolatedDirection,
+    const CaloHitGrid &viewHitGrid, CaloHitVector &candidateHits) const
+{
+    const float directionMagnitude(extrapolatedDirection.GetMagnitude());
+
+    if (directionMagnitude < std::numeric_limits<float>::epsilon())
+    {
+        viewHitGrid.GetAllHits(candidateHits);
+        return;
+    }
+
+    // Parameterise positions as start + (u * lineDirection) + (v * lineNormal). A collected hit is close to the line, |v| < maxV, allowing
+    // for the hit width, and its position along the fit axis, L = startL + (u * axisDotLine) + (v * axisDotNormal), is within the section
+    const CartesianVector lineDirection(extrapolatedDirection * (1.f / directionMagnitude));
+    const CartesianVector lineNormal(lineDirection.GetZ(), 0.f, -lineDirection.GetX());
+    const float axisDotLine(extrapolatedFit.GetAxisDirection().GetDotProduct(lineDirection));
+    const float axisDotNormal(extrapolatedFit.GetAxisDirection().GetDotProduct(lineNormal));
+
+    // ATTN If the projection is (almost) perpendicular to the fit axis, the region is unbounded (or too large to be worth indexing)
+    if (std::fabs(axisDotLine) < 0.01f)
+    {
+        viewHitGrid.GetAllHits(candidateHits);
+        return;
+    }
+
+    const float maxV((m_distanceToLine / directionMagnitude) + (0.5f * viewHitGrid.GetMaxHitWidth()));
+    float minX(std::numeric_limits<float>::max()), maxX(-std::numeric_limits<float>::max());
+    float minZ(std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
+
+    for (const float v : {-maxV, maxV})
+    {
+        for (const float sectionL : {extrapolatedStartL, extrapolatedEndL})
+        {
+            const float u((sectionL - extrapolatedStartL - (v * axisDotNormal)) / axisDotLine);
+            const CartesianVector corner(extrapolatedStartPosition + (lineDirection * u) + (lineNormal * v));
+
+            minX = std::min(minX, corner.GetX());
+            maxX = std::max(maxX, corner.GetX());
+            minZ = std::min(minZ, corner.GetZ());
+            maxZ = std::max(maxZ, corner.GetZ());
+        }
+    }
+
+    // ATTN Pad the search region by a grid cell, so that no hit inside the bounds can be missed due to rounding
+    const float pad(m_searchGridCellSize);
+    viewHitGrid.Search(KDTreeBox(minX - pad, maxX + pad, minZ - pad, maxZ + pad), candidateHits);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool ShowerSpineFinderTool::IsCloseToLine(const CartesianVector &hitPosition, const CartesianVector &lineStart,
     const CartesianVector &lineDirection, const float distanceToLine) const
 {
@@ -226,7 +303,8 @@ bool ShowerSpineFinderTool::IsCloseToLine(const CartesianVector &hitPosition, co
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ShowerSpineFinderTool::CollectConnectedHits(const CaloHitList &collectedHits, const CartesianVector &extrapolatedStartPosition,
-    const CartesianVector &extrapolatedDirection, CartesianPointVector &runningFitPositionVector, CaloHitList &showerSpineHitList) const
+    const CartesianVector &extrapolatedDirection, CartesianPointVector &runningFitPositionVector, CaloHitSet &showerSpineHitSet,
+    CaloHitGrid &showerSpineHitGrid, CaloHitList &showerSpineHitList) const
 {
     bool found(true);
 
@@ -236,14 +314,14 @@ void ShowerSpineFinderTool::CollectConnectedHits(const CaloHitList &collectedHit
 
         for (const CaloHit *const pCaloHit : collectedHits)
         {
-            if (std::find(showerSpineHitList.begin(), showerSpineHitList.end(), pCaloHit) != showerSpineHitList.end())
+            if (showerSpineHitSet.count(pCaloHit))
                 continue;
 
             CartesianVector hitPosition(pCaloHit->GetPositionVector());
 
             if (this->GetClosestDistance(hitPosition, runningFitPositionVector) > m_hitConnectionDistance)
             {
-                if (LArHitWidthHelper::GetClosestDistance(pCaloHit, showerSpineHitList) > m_hitConnectionDistance)
+                if (!this->IsConnectedToShowerSpine(pCaloHit, showerSpineHitGrid))
                     continue;
 
                 hitPosition = LArHitWidthHelper::GetClosestPointToLine2D(extrapolatedStartPosition, extrapolatedDirection, pCaloHit);
@@ -252,13 +330,47 @@ void ShowerSpineFinderTool::CollectConnectedHits(const CaloHitList &collectedHit
             found = true;
 
             runningFitPositionVector.push_back(hitPosition);
-            showerSpineHitList.push_back(pCaloHit);
+            this->AddToShowerSpine(pCaloHit, showerSpineHitSet, showerSpineHitGrid, showerSpineHitList);
         }
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ShowerSpineFinderTool::AddToShowerSpine(
+    const CaloHit *const pCaloHit, CaloHitSet &showerSpineHitSet, CaloHitGrid &showerSpineHitGrid, CaloHitList &showerSpineHitList) const
+{
+    showerSpineHitList.push_back(pCaloHit);
+
+    if (showerSpineHitSet.insert(pCaloHit).second)
+        showerSpineHitGrid.Insert(pCaloHit);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ShowerSpineFinderTool::IsConnectedToShowerSpine(const CaloHit *const pCaloHit, const CaloHitGrid &showerSpineHitGrid) const
+{
+    // Hits within the hit connection distance, allowing for hit widths, have centres within these x and z windows (the search region is
+    // padded by a grid cell, so that no such hit can be missed due to rounding)
+    const CartesianVector &hitPosition(pCaloHit->GetPositionVector());
+    const float xWindow(m_hitConnectionDistance + (0.5f * (pCaloHit->GetCellSize1() + showerSpineHitGrid.GetMaxHitWidth())));
+    const float zWindow(m_hitConnectionDistance);
+
+    CaloHitVector nearbySpineHits;
+    showerSpineHitGrid.Search(
+        build_2d_kd_search_region(hitPosition, xWindow + m_searchGridCellSize, zWindow + m_searchGridCellSize), nearbySpineHits);
+
+    for (const CaloHit *const pSpineHit : nearbySpineHits)
+    {
+        if (LArHitWidthHelper::GetClosestDistance(pCaloHit, pSpineHit) <= m_hitConnectionDistance)
+            return true;
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float ShowerSpineFinderTool::GetClosestDistance(const CartesianVector &position, const CartesianPointVector &testPositions) const
 {
     float closestDistanceSqaured(std::numeric_limits<float>::max());
@@ -306,6 +418,15 @@ StatusCode ShowerSpineFinderTool::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "HitConnectionDistance", m_hitConnectionDistance));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SearchGridCellSize", m_searchGridCellSize));
+
+    if (m_searchGridCellSize < std::numeric_limits<float>::epsilon())
+    {
+        std::cout << "ShowerSpineFinderTool: SearchGridCellSize must be positive" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -13,6 +13,8 @@
 
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
+#include "larpandoracontent/LArUtility/CaloHitGrid.h"
+
 namespace lar_content
 {
 
@@ -47,17 +49,36 @@ private:
      *  @param  extrapolatedEndPosition the shower spine projection end position
      *  @param  extrapolatedDirection the shower spine projection direction
      *  @param  isEndDownstream whether the shower direction is downstream (in Z) of the neutrino vertex
-     *  @param  pViewHitList the 2D event hit list
+     *  @param  viewHitGrid the spatial index of the 2D event hits
+     *  @param  unavailableHitSet protected hits that cannot be collected
      *  @param  runningFitPositionVector the vector of the hitherto collected hit positions
-     *  @param  unavailableHitList protected hits that cannot be collected
+     *  @param  showerSpineHitSet the set of shower spine hits
+     *  @param  showerSpineHitGrid the spatial index of the shower spine hits
      *  @param  showerSpineHitList the output list of shower spine hits
      *
      *  @return whether any hits were collected in the running fit step
      */
     bool CollectSubsectionHits(const TwoDSlidingFitResult &extrapolatedFit, const pandora::CartesianVector &extrapolatedStartPosition,
         const pandora::CartesianVector &extrapolatedEndPosition, const pandora::CartesianVector &extrapolatedDirection,
-        const bool isEndDownstream, const pandora::CaloHitList *const pViewHitList, pandora::CartesianPointVector &runningFitPositionVector,
-        pandora::CaloHitList &unavailableHitList, pandora::CaloHitList &showerSpineHitList) const;
+        const bool isEndDownstream, const CaloHitGrid &viewHitGrid, const pandora::CaloHitSet &unavailableHitSet,
+        pandora::CartesianPointVector &runningFitPositionVector, pandora::CaloHitSet &showerSpineHitSet, CaloHitGrid &showerSpineHitGrid,
+        pandora::CaloHitList &showerSpineHitList) const;
+
+    /**
+     *  @brief  Find the event hits which may lie within the section boundaries and close to the shower spine projection, a superset of
+     *          the hits that can be collected in a running fit step
+     *
+     *  @param  extrapolatedFit the fit to the hitherto collected hits
+     *  @param  extrapolatedStartL the longitudinal coordinate of the shower spine projection start position
+     *  @param  extrapolatedEndL the longitudinal coordinate of the shower spine projection end position
+     *  @param  extrapolatedStartPosition the shower spine projection start position
+     *  @param  extrapolatedDirection the shower spine projection direction
+     *  @param  viewHitGrid the spatial index of the 2D event hits
+     *  @param  candidateHits to receive the candidate hits, in event hit list order
+     */
+    void FindCandidateHits(const TwoDSlidingFitResult &extrapolatedFit, const float extrapolatedStartL, const float extrapolatedEndL,
+        const pandora::CartesianVector &extrapolatedStartPosition, const pandora::CartesianVector &extrapolatedDirection,
+        const CaloHitGrid &viewHitGrid, pandora::CaloHitVector &candidateHits) const;
 
     /**
      *  @brief  Determine whether a hit lies close to the shower spine projection
@@ -79,12 +100,35 @@ private:
      *  @param  extrapolatedStartPosition the shower spine projection start position
      *  @param  extrapolatedDirection the shower spine projection direction
      *  @param  runningFitPositionVector the vector of the collected hit positions
+     *  @param  showerSpineHitSet the set of collected shower spine hits
+     *  @param  showerSpineHitGrid the spatial index of the collected shower spine hits
      *  @param  showerSpineHitList the list of collected shower spine hits
      */
     void CollectConnectedHits(const pandora::CaloHitList &collectedHits, const pandora::CartesianVector &extrapolatedStartPosition,
         const pandora::CartesianVector &extrapolatedDirection, pandora::CartesianPointVector &runningFitPositionVector,
+        pandora::CaloHitSet &showerSpineHitSet, CaloHitGrid &showerSpineHitGrid, pandora::CaloHitList &showerSpineHitList) const;
+
+    /**
+     *  @brief  Add a hit to the shower spine
+     *
+     *  @param  pCaloHit the address of the hit
+     *  @param  showerSpineHitSet the set of collected shower spine hits
+     *  @param  showerSpineHitGrid the spatial index of the collected shower spine hits
+     *  @param  showerSpineHitList the list of collected shower spine hits
+     */
+    void AddToShowerSpine(const pandora::CaloHit *const pCaloHit, pandora::CaloHitSet &showerSpineHitSet, CaloHitGrid &showerSpineHitGrid,
         pandora::CaloHitList &showerSpineHitList) const;
 
+    /**
+     *  @brief  Determine whether a hit lies within the hit connection distance of a shower spine hit, taking account of hit widths
+     *
+     *  @param  pCaloHit the address of the hit
+     *  @param  showerSpineHitGrid the spatial index of the collected shower spine hits
+     *
+     *  @return whether the hit is connected to the shower spine
+     */
+    bool IsConnectedToShowerSpine(const pandora::CaloHit *const pCaloHit, const CaloHitGrid &showerSpineHitGrid) const;
+
     /**
      *  @brief  Find the smallest distance between a position and a list of other positions
      *
@@ -105,9 +149,9 @@ private:
     unsigned int m_highResolutionSlidingFitWindow; ///< The high resolution sliding fit window for spine fits
     float m_distanceToLine;                        ///< The max. proximity to the spine projection for collection
     float m_hitConnectionDistance;                 ///< The max. separation between connected hits
+    float m_searchGridCellSize;                    ///< The cell size of the spatial indices used in hit searches
 };
 
-//------------------------------------------------------------------------------------------------------------------------------------------
 } // namespace lar_content
 
 #endif // #ifndef LAR_SHOWER_SPINE_FINDER_TOOL_H
@@ -57,89 +57,87 @@ void DeltaRayMatchingContainers::AddToClusterMap(const Cluster *const pCluster)
     HitToClusterMap &hitToClusterMap((hitType == TPC_VIEW_U) ? m_hitToClusterMapU
             : (hitType == TPC_VIEW_V)                        ? m_hitToClusterMapV
                                                              : m_hitToClusterMapW);
+    CaloHitGrid &hitGrid((hitType == TPC_VIEW_U) ? m_hitGridU : (hitType == TPC_VIEW_V) ? m_hitGridV : m_hitGridW);
+
+    if (hitGrid.IsEmpty())
+        hitGrid.SetCellSize(m_searchRegion1D);
 
     CaloHitList caloHitList;
     pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
 
     for (const CaloHit *const pCaloHit : caloHitList)
-        hitToClusterMap[pCaloHit] = pCluster;
+    {
+        const std::pair<HitToClusterMap::iterator, bool> insertResult(
+            hitToClusterMap.insert(HitToClusterMap::value_type(pCaloHit, pCluster)));
+
+        if (insertResult.second)
+        {
+            hitGrid.Insert(pCaloHit);
+        }
+        else
+        {
+            insertResult.first->second = pCluster;
+        }
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void DeltaRayMatchingContainers::FillClusterProximityMap(const ClusterList &inputClusterList)
 {
-    if (inputClusterList.empty())
-        return;
-
-    const HitType hitType(LArClusterHelper::GetClusterHitType(inputClusterList.front()));
-
-    this->BuildKDTree(hitType);
-
     for (const Cluster *const pCluster : inputClusterList)
         this->AddToClusterProximityMap(pCluster);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void DeltaRayMatchingContainers::BuildKDTree(const HitType hitType)
-{
-    const HitToClusterMap &hitToClusterMap((hitType == TPC_VIEW_U) ? m_hitToClusterMapU
-            : (hitType == TPC_VIEW_V)                              ? m_hitToClusterMapV
-                                                                   : m_hitToClusterMapW);
-    HitKDTree2D &kdTree((hitType == TPC_VIEW_U) ? m_kdTreeU : (hitType == TPC_VIEW_V) ? m_kdTreeV : m_kdTreeW);
-
-    CaloHitList allCaloHits;
-
-    for (auto &entry : hitToClusterMap)
-        allCaloHits.push_back(entry.first);
-
-    HitKDNode2DList hitKDNode2DList;
-    KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(allCaloHits, hitKDNode2DList));
-
-    kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
 void DeltaRayMatchingContainers::AddToClusterProximityMap(const Cluster *const pCluster)
 {
     const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
     const HitToClusterMap &hitToClusterMap((hitType == TPC_VIEW_U) ? m_hitToClusterMapU
             : (hitType == TPC_VIEW_V)                              ? m_hitToClusterMapV
                                                                    : m_hitToClusterMapW);
-    HitKDTree2D &kdTree((hitType == TPC_VIEW_U) ? m_kdTreeU : (hitType == TPC_VIEW_V) ? m_kdTreeV : m_kdTreeW);
+    const CaloHitGrid &hitGrid((hitType == TPC_VIEW_U) ? m_hitGridU : (hitType == TPC_VIEW_V) ? m_hitGridV : m_hitGridW);
     ClusterProximityMap &clusterProximityMap((hitType == TPC_VIEW_U) ? m_clusterProximityMapU
             : (hitType == TPC_VIEW_V)                                ? m_clusterProximityMapV
                                                                      : m_clusterProximityMapW);
 
+    // ATTN: Proximity is symmetric, so a cluster is absent from the list of a nearby cluster if, and only if, the reverse is also true
+    ClusterSet nearbyClusterSet;
+    const ClusterProximityMap::const_iterator proximityIter(clusterProximityMap.find(pCluster));
+
+    if (proximityIter != clusterProximityMap.end())
+        nearbyClusterSet.insert(proximityIter->second.begin(), proximityIter->second.end());
+
     CaloHitList caloHitList;
     pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
 
+    CaloHitVector foundHits;
+    ClusterVector newNearbyClusters;
+
     for (const CaloHit *const pCaloHit : caloHitList)
     {
-        HitKDNode2DList found;
-        KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D));
+        foundHits.clear();
+        hitGrid.Search(build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D), foundHits);
 
-        kdTree.search(searchRegionHits, found);
-
-        for (const auto &hit : found)
+        for (const CaloHit *const pFoundHit : foundHits)
         {
-            const Cluster *const pNearbyCluster(hitToClusterMap.at(hit.data));
+            const Cluster *const pNearbyCluster(hitToClusterMap.at(pFoundHit));
 
-            if (pNearbyCluster == pCluster)
+            if ((pNearbyCluster == pCluster) || !nearbyClusterSet.insert(pNearbyCluster).second)
                 continue;
 
-            ClusterList &nearbyClusterList(clusterProximityMap[pCluster]);
-
-            if (std::find(nearbyClusterList.begin(), nearbyClusterList.end(), pNearbyCluster) == nearbyClusterList.end())
-                nearbyClusterList.push_back(pNearbyCluster);
+            newNearbyClusters.push_back(pNearbyCluster);
+        }
+    }
 
-            ClusterList &invertedNearbyClusterList(clusterProximityMap[pNearbyCluster]);
+    // ATTN: Downstream matching iterates proximity lists in order, so append new neighbours in a well-defined order, not grid order
+    std::sort(newNearbyClusters.begin(), newNearbyClusters.end(), LArClusterHelper::SortByNHits);
 
-            if (std::find(invertedNearbyClusterList.begin(), invertedNearbyClusterList.end(), pCluster) == invertedNearbyClusterList.end())
-                invertedNearbyClusterList.push_back(pCluster);
-        }
+    for (const Cluster *const pNearbyCluster : newNearbyClusters)
+    {
+        clusterProximityMap[pCluster].push_back(pNearbyCluster);
+        clusterProximityMap[pNearbyCluster].push_back(pCluster);
     }
 }
 
@@ -207,6 +205,7 @@ void DeltaRayMatchingContainers::RemoveClusterFromContainers(const Cluster *cons
     ClusterToPfoMap &clusterToPfoMap((hitType == TPC_VIEW_U) ? m_clusterToPfoMapU
             : (hitType == TPC_VIEW_V)                        ? m_clusterToPfoMapV
                                                              : m_clusterToPfoMapW);
+    CaloHitGrid &hitGrid((hitType == TPC_VIEW_U) ? m_hitGridU : (hitType == TPC_VIEW_V) ? m_hitGridV : m_hitGridW);
 
     CaloHitList caloHitList;
     pDeletedCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
@@ -219,6 +218,7 @@ void DeltaRayMatchingContainers::RemoveClusterFromContainers(const Cluster *cons
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
         hitToClusterMap.erase(iter);
+        hitGrid.Remove(pCaloHit);
     }
 
     const ClusterProximityMap::const_iterator clusterProximityIter(clusterProximityMap.find(pDeletedCluster));
@@ -257,9 +257,9 @@ void DeltaRayMatchingContainers::ClearContainers()
     m_hitToClusterMapV.clear();
     m_hitToClusterMapW.clear();
 
-    m_kdTreeU.clear();
-    m_kdTreeV.clear();
-    m_kdTreeW.clear();
+    m_hitGridU.Clear();
+    m_hitGridV.Clear();
+    m_hitGridW.Clear();
 
     m_clusterProximityMapU.clear();
     m_clusterProximityMapV.clear();
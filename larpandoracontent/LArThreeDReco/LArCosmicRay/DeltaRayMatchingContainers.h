@@ -10,7 +10,7 @@
 
 #include "Pandora/PandoraInternal.h"
 
-#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+#include "larpandoracontent/LArUtility/CaloHitGrid.h"
 
 namespace lar_content
 {
@@ -82,13 +82,10 @@ public:
      */
     void ClearContainers();
 
-    float m_searchRegion1D; ///< Search region, applied to each dimension, for look-up from kd-tree
+    float m_searchRegion1D; ///< Search region, applied to each dimension, for look-up from the hit grids
 
 private:
-    typedef std::map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
-    typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
-    typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
-    typedef std::vector<HitKDNode2D> HitKDNode2DList;
+    typedef std::unordered_map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
 
     /**
      *  @brief  Populate the hit to cluster map from a list of clusters
@@ -118,13 +115,6 @@ private:
      */
     void FillClusterProximityMap(const pandora::ClusterList &inputClusterList);
 
-    /**
-     *  @brief  Build the KD tree
-     *
-     *  @param  hitType the hit type of the KD tree to build
-     */
-    void BuildKDTree(const pandora::HitType hitType);
-
     /**
      *  @brief  Add a cluster to the cluster proximity map
      *
@@ -135,9 +125,9 @@ private:
     HitToClusterMap m_hitToClusterMapU;         ///< The mapping of hits to the clusters to which they belong (in the U view)
     HitToClusterMap m_hitToClusterMapV;         ///< The mapping of hits to the clusters to which they belong (in the V view)
     HitToClusterMap m_hitToClusterMapW;         ///< The mapping of hits to the clusters to which they belong (in the W view)
-    HitKDTree2D m_kdTreeU;                      ///< The KD tree (in the U view)
-    HitKDTree2D m_kdTreeV;                      ///< The KD tree (in the V view)
-    HitKDTree2D m_kdTreeW;                      ///< The KD tree (in the W view)
+    CaloHitGrid m_hitGridU;                     ///< The spatial index of the hits in the hit to cluster map (in the U view)
+    CaloHitGrid m_hitGridV;                     ///< The spatial index of the hits in the hit to cluster map (in the V view)
+    CaloHitGrid m_hitGridW;                     ///< The spatial index of the hits in the hit to cluster map (in the W view)
     ClusterProximityMap m_clusterProximityMapU; ///< The mapping of clusters to their neighbouring clusters (in the U view)
     ClusterProximityMap m_clusterProximityMapV; ///< The mapping of clusters to their neighbouring clusters (in the V view)
     ClusterProximityMap m_clusterProximityMapW; ///< The mapping of clusters to their neighbouring clusters (in the W view)
@@ -42,6 +42,16 @@ void ThreeViewDeltaRayMatchingAlgorithm::CalculateOverlapResult(const Cluster *c
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool ThreeViewDeltaRayMatchingAlgorithm::GetClusterXSpan(const Cluster *const pCluster, float &minX, float &maxX) const
+{
+    // ATTN Overlap results require the cluster x spans to overlap
+    pCluster->GetClusterSpanX(minX, maxX);
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ThreeViewDeltaRayMatchingAlgorithm::CalculateOverlapResult(const Cluster *const pClusterU, const Cluster *const pClusterV,
     const Cluster *const pClusterW, DeltaRayOverlapResult &overlapResult) const
 {
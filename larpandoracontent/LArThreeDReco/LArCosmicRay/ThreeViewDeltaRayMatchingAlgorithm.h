@@ -48,6 +48,7 @@ private:
     typedef std::vector<DeltaRayTensorTool *> TensorToolVector;
 
     void CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW);
+    bool GetClusterXSpan(const pandora::Cluster *const pCluster, float &minX, float &maxX) const;
     void ExamineOverlapContainer();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -13,6 +13,8 @@
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/ShowerHitsBaseTool.h"
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/ThreeDHitCreationAlgorithm.h"
 
+#include <algorithm>
+
 using namespace pandora;
 
 namespace lar_content
@@ -55,13 +57,17 @@ void ShowerHitsBaseTool::Run(ThreeDHitCreationAlgorithm *const pAlgorithm, const
 void ShowerHitsBaseTool::GetShowerHits3D(const CaloHitVector &inputTwoDHits, const CaloHitVector &caloHitVector1,
     const CaloHitVector &caloHitVector2, ProtoHitVector &protoHitVector) const
 {
+    XIndexVector xIndexVector1, xIndexVector2;
+    this->GetXIndexVector(caloHitVector1, xIndexVector1);
+    this->GetXIndexVector(caloHitVector2, xIndexVector2);
+
     for (const CaloHit *const pCaloHit2D : inputTwoDHits)
     {
         try
         {
             CaloHitVector filteredHits1, filteredHits2;
-            this->FilterCaloHits(pCaloHit2D->GetPositionVector().GetX(), m_xTolerance, caloHitVector1, filteredHits1);
-            this->FilterCaloHits(pCaloHit2D->GetPositionVector().GetX(), m_xTolerance, caloHitVector2, filteredHits2);
+            this->FilterCaloHits(pCaloHit2D->GetPositionVector().GetX(), m_xTolerance, caloHitVector1, xIndexVector1, filteredHits1);
+            this->FilterCaloHits(pCaloHit2D->GetPositionVector().GetX(), m_xTolerance, caloHitVector2, xIndexVector2, filteredHits2);
 
             ProtoHit protoHit(pCaloHit2D);
             this->GetShowerHit3D(filteredHits1, filteredHits2, protoHit);
@@ -77,15 +83,37 @@ void ShowerHitsBaseTool::GetShowerHits3D(const CaloHitVector &inputTwoDHits, con
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ShowerHitsBaseTool::FilterCaloHits(const float x, const float xTolerance, const CaloHitVector &inputCaloHitVector, CaloHitVector &outputCaloHitVector) const
+void ShowerHitsBaseTool::GetXIndexVector(const CaloHitVector &caloHitVector, XIndexVector &xIndexVector) const
 {
-    for (const CaloHit *const pCaloHit : inputCaloHitVector)
-    {
-        const float deltaX(pCaloHit->GetPositionVector().GetX() - x);
+    xIndexVector.reserve(caloHitVector.size());
 
-        if (std::fabs(deltaX) < xTolerance)
-            outputCaloHitVector.push_back(pCaloHit);
-    }
+    for (unsigned int index = 0; index < caloHitVector.size(); ++index)
+        xIndexVector.emplace_back(caloHitVector.at(index)->GetPositionVector().GetX(), index);
+
+    std::sort(xIndexVector.begin(), xIndexVector.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ShowerHitsBaseTool::FilterCaloHits(const float x, const float xTolerance, const CaloHitVector &inputCaloHitVector,
+    const XIndexVector &xIndexVector, CaloHitVector &outputCaloHitVector) const
+{
+    // ATTN Rounding of deltaX is monotonic in hit x, so hits satisfying |deltaX| < xTolerance form a contiguous range of the sorted vector
+    const XIndexVector::const_iterator lowerIter(std::partition_point(xIndexVector.begin(), xIndexVector.end(),
+        [x, xTolerance](const XIndexVector::value_type &xIndex) { return ((xIndex.first - x) <= -xTolerance); }));
+    const XIndexVector::const_iterator upperIter(std::partition_point(
+        lowerIter, xIndexVector.end(), [x, xTolerance](const XIndexVector::value_type &xIndex) { return ((xIndex.first - x) < xTolerance); }));
+
+    std::vector<unsigned int> indices;
+    indices.reserve(std::distance(lowerIter, upperIter));
+
+    for (XIndexVector::const_iterator iter = lowerIter; iter != upperIter; ++iter)
+        indices.push_back(iter->second);
+
+    std::sort(indices.begin(), indices.end());
+
+    for (const unsigned int index : indices)
+        outputCaloHitVector.push_back(inputCaloHitVector.at(index));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -53,15 +53,26 @@ protected:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
 private:
+    typedef std::vector<std::pair<float, unsigned int>> XIndexVector;
+
+    /**
+     *  @brief  Get the x coordinates of a vector of calo hits, paired with the hit indices and sorted by x coordinate then index
+     *
+     *  @param  caloHitVector the calo hit vector
+     *  @param  xIndexVector to receive the sorted x coordinates and hit indices
+     */
+    void GetXIndexVector(const pandora::CaloHitVector &caloHitVector, XIndexVector &xIndexVector) const;
+
     /**
      *  @brief  Filter a list of calo hits to find those within a specified tolerance of a give x position
      *
      *  @param  x the x position
      *  @param  xTolerance the x tolerance
      *  @param  inputCaloHitVector the input calo hit vector
-     *  @param  outputCaloHitVector to receive the output calo hit vector
+     *  @param  xIndexVector the sorted x coordinates and indices of the hits in the input calo hit vector
+     *  @param  outputCaloHitVector to receive the output calo hit vector, preserving the input hit order
      */
-    void FilterCaloHits(const float x, const float xTolerance, const pandora::CaloHitVector &inputCaloHitVector,
+    void FilterCaloHits(const float x, const float xTolerance, const pandora::CaloHitVector &inputCaloHitVector, const XIndexVector &xIndexVector,
         pandora::CaloHitVector &outputCaloHitVector) const;
 
     float m_xTolerance; ///< The x tolerance to use when looking for associated calo hits between views
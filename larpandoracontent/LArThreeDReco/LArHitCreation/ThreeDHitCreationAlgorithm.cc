@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
 
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
 
@@ -18,6 +19,7 @@
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/ThreeDHitCreationAlgorithm.h"
 
 #include <algorithm>
+#include <exception>
 
 using namespace pandora;
 
@@ -30,7 +32,8 @@ ThreeDHitCreationAlgorithm::ThreeDHitCreationAlgorithm() :
     m_slidingFitHalfWindow(10),
     m_nHitRefinementIterations(10),
     m_sigma3DFitMultiplier(0.2),
-    m_iterationMaxChi2Ratio(1.)
+    m_iterationMaxChi2Ratio(1.),
+    m_nProtoHitThreads(1)
 {
 }
 
@@ -66,23 +69,59 @@ StatusCode ThreeDHitCreationAlgorithm::Run()
     PfoVector pfoVector(pPfoList->begin(), pPfoList->end());
     std::sort(pfoVector.begin(), pfoVector.end(), LArPfoHelper::SortByNHits);
 
-    for (const ParticleFlowObject *const pPfo : pfoVector)
+    // Proto hits for each pfo are calculated into their own slot, then the 3D hits are created serially, in pfo order. ATTN Tools may use
+    // the 3D hits of a parent pfo (e.g. for delta rays), so the proto hits for a pfo whose parent precedes it are calculated serially
+    const unsigned int nPfos(pfoVector.size());
+    std::vector<bool> isDeferred(nPfos, false);
+    PfoSet precedingPfos;
+
+    for (unsigned int pfoIndex = 0; pfoIndex < nPfos; ++pfoIndex)
     {
-        ProtoHitVector protoHitVector;
+        const ParticleFlowObject *const pPfo(pfoVector.at(pfoIndex));
 
-        for (HitCreationBaseTool *const pHitCreationTool : m_algorithmToolVector)
+        for (const ParticleFlowObject *const pParentPfo : pPfo->GetParentPfoList())
         {
-            CaloHitVector remainingTwoDHits;
-            this->SeparateTwoDHits(pPfo, protoHitVector, remainingTwoDHits);
+            if (precedingPfos.count(pParentPfo))
+                isDeferred.at(pfoIndex) = true;
+        }
 
-            if (remainingTwoDHits.empty())
-                break;
+        (void)precedingPfos.insert(pPfo);
+    }
 
-            pHitCreationTool->Run(this, pPfo, remainingTwoDHits, protoHitVector);
-        }
+    // ATTN: Hit creation tools print algorithm info as they run, so stay on a single thread when it is displayed to keep output readable
+    const bool displayInfo(PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo());
+    const unsigned int nThreads(displayInfo ? 1 : LArThreadingHelper::GetNThreads(m_nProtoHitThreads, nPfos));
 
-        if ((m_iterateTrackHits && LArPfoHelper::IsTrack(pPfo)) || (m_iterateShowerHits && LArPfoHelper::IsShower(pPfo)))
-            this->IterativeTreatment(protoHitVector);
+    std::vector<ProtoHitVector> protoHitVectors(nPfos);
+    std::vector<std::exception_ptr> pfoExceptions(nPfos);
+
+    LArThreadingHelper::RunTasks(nThreads, nPfos,
+        [&](const unsigned int, const unsigned int pfoIndex)
+        {
+            if (isDeferred.at(pfoIndex))
+                return;
+
+            try
+            {
+                this->CalculateProtoHits(pfoVector.at(pfoIndex), protoHitVectors.at(pfoIndex));
+            }
+            catch (...)
+            {
+                // ATTN Rethrown in pfo order, so that the 3D hits for preceding pfos are still created
+                pfoExceptions.at(pfoIndex) = std::current_exception();
+            }
+        });
+
+    for (unsigned int pfoIndex = 0; pfoIndex < nPfos; ++pfoIndex)
+    {
+        if (pfoExceptions.at(pfoIndex))
+            std::rethrow_exception(pfoExceptions.at(pfoIndex));
+
+        const ParticleFlowObject *const pPfo(pfoVector.at(pfoIndex));
+        ProtoHitVector &protoHitVector(protoHitVectors.at(pfoIndex));
+
+        if (isDeferred.at(pfoIndex))
+            this->CalculateProtoHits(pPfo, protoHitVector);
 
         if (protoHitVector.empty())
             continue;
@@ -102,6 +141,25 @@ StatusCode ThreeDHitCreationAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ThreeDHitCreationAlgorithm::CalculateProtoHits(const ParticleFlowObject *const pPfo, ProtoHitVector &protoHitVector)
+{
+    for (HitCreationBaseTool *const pHitCreationTool : m_algorithmToolVector)
+    {
+        CaloHitVector remainingTwoDHits;
+        this->SeparateTwoDHits(pPfo, protoHitVector, remainingTwoDHits);
+
+        if (remainingTwoDHits.empty())
+            break;
+
+        pHitCreationTool->Run(this, pPfo, remainingTwoDHits, protoHitVector);
+    }
+
+    if ((m_iterateTrackHits && LArPfoHelper::IsTrack(pPfo)) || (m_iterateShowerHits && LArPfoHelper::IsShower(pPfo)))
+        this->IterativeTreatment(protoHitVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeDHitCreationAlgorithm::SeparateTwoDHits(
     const ParticleFlowObject *const pPfo, const ProtoHitVector &protoHitVector, CaloHitVector &remainingHitVector) const
 {
@@ -497,6 +555,9 @@ StatusCode ThreeDHitCreationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "IterationMaxChi2Ratio", m_iterationMaxChi2Ratio));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NProtoHitThreads", m_nProtoHitThreads));
+
     return STATUS_CODE_SUCCESS;
 }
 
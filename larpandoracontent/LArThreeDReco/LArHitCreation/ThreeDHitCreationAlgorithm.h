@@ -180,6 +180,15 @@ public:
 private:
     pandora::StatusCode Run();
 
+    /**
+     *  @brief  Calculate the proto hits for a pfo, running the hit creation tools and, if configured, the iterative treatment. This only
+     *          reads the 2D hits, so may be called concurrently for different pfos
+     *
+     *  @param  pPfo the address of the pfo
+     *  @param  protoHitVector to receive the vector of proto hits
+     */
+    void CalculateProtoHits(const pandora::ParticleFlowObject *const pPfo, ProtoHitVector &protoHitVector);
+
     /**
      *  @brief  Get the list of 2D calo hits in a pfo for which 3D hits have and have not been created
      *
@@ -281,6 +290,7 @@ private:
     unsigned int m_nHitRefinementIterations; ///< The maximum number of hit refinement iterations
     double m_sigma3DFitMultiplier;           ///< Multiplicative factor: sigmaUVW (same as sigmaHit and sigma2DFit) to sigma3DFit
     double m_iterationMaxChi2Ratio;          ///< Max ratio between current and previous chi2 values to cease iterations
+    unsigned int m_nProtoHitThreads;         ///< The number of threads used to calculate proto hits (zero for hardware concurrency)
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -32,16 +32,25 @@ void ThreeViewLongitudinalTracksAlgorithm::CalculateOverlapResult(
     const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW)
 {
     LongitudinalOverlapResult overlapResult;
-    this->CalculateOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult);
 
-    if (overlapResult.IsInitialized())
+    if (this->CalculateThreadSafeOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult))
         this->GetMatchingControl().GetOverlapTensor().SetOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool ThreeViewLongitudinalTracksAlgorithm::CalculateThreadSafeOverlapResult(const Cluster *const pClusterU, const Cluster *const pClusterV,
+    const Cluster *const pClusterW, LongitudinalOverlapResult &overlapResult) const
+{
+    this->CalculateOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult);
+
+    return overlapResult.IsInitialized();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeViewLongitudinalTracksAlgorithm::CalculateOverlapResult(const Cluster *const pClusterU, const Cluster *const pClusterV,
-    const Cluster *const pClusterW, LongitudinalOverlapResult &longitudinalOverlapResult)
+    const Cluster *const pClusterW, LongitudinalOverlapResult &longitudinalOverlapResult) const
 {
     const TwoDSlidingFitResult &slidingFitResultU(this->GetCachedSlidingFitResult(pClusterU));
     const TwoDSlidingFitResult &slidingFitResultV(this->GetCachedSlidingFitResult(pClusterV));
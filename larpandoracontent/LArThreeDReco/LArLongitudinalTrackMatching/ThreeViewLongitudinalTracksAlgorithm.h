@@ -26,7 +26,8 @@ class LongitudinalTensorTool;
 /**
  *  @brief  ThreeViewLongitudinalTracksAlgorithm class
  */
-class ThreeViewLongitudinalTracksAlgorithm : public NViewTrackMatchingAlgorithm<ThreeViewMatchingControl<LongitudinalOverlapResult>>
+class ThreeViewLongitudinalTracksAlgorithm : public NViewTrackMatchingAlgorithm<ThreeViewMatchingControl<LongitudinalOverlapResult>>,
+                                             public ThreeViewOverlapCalculator<LongitudinalOverlapResult>
 {
 public:
     typedef NViewTrackMatchingAlgorithm<ThreeViewMatchingControl<LongitudinalOverlapResult>> BaseAlgorithm;
@@ -38,6 +39,8 @@ public:
 
 private:
     void CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW);
+    bool CalculateThreadSafeOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV,
+        const pandora::Cluster *const pClusterW, LongitudinalOverlapResult &overlapResult) const;
 
     /**
      *  @brief  Calculate the overlap result for given group of clusters
@@ -48,7 +51,7 @@ private:
      *  @param  overlapResult to receive the overlap result
      */
     void CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV,
-        const pandora::Cluster *const pClusterW, LongitudinalOverlapResult &overlapResult);
+        const pandora::Cluster *const pClusterW, LongitudinalOverlapResult &overlapResult) const;
 
     /**
      *  @brief  Calculate the overlap result for given 3D vertex and end positions
@@ -88,6 +88,18 @@ void ThreeViewRemnantsAlgorithm::CalculateOverlapResult(const Cluster *const pCl
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool ThreeViewRemnantsAlgorithm::GetClusterXSpan(const Cluster *const pCluster, float &minX, float &maxX) const
+{
+    // ATTN Overlap results require the cluster x spans, each extended by the overlap window, to overlap
+    pCluster->GetClusterSpanX(minX, maxX);
+    minX -= m_xOverlapWindow;
+    maxX += m_xOverlapWindow;
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeViewRemnantsAlgorithm::ExamineOverlapContainer()
 {
     unsigned int repeatCounter(0);
@@ -38,6 +38,7 @@ public:
 
 private:
     void CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW);
+    bool GetClusterXSpan(const pandora::Cluster *const pCluster, float &minX, float &maxX) const;
     void ExamineOverlapContainer();
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
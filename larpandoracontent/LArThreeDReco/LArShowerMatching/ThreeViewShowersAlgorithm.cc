@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArShowerMatching/ThreeViewShowersAlgorithm.h"
 
@@ -21,6 +22,7 @@ namespace lar_content
 ThreeViewShowersAlgorithm::ThreeViewShowersAlgorithm() :
     m_nMaxTensorToolRepeats(1000),
     m_slidingFitWindow(20),
+    m_useSharedSlidingFitCache(false),
     m_ignoreUnavailableClusters(true),
     m_minClusterCaloHits(5),
     m_minClusterLengthSquared(3.f * 3.f),
@@ -32,6 +34,14 @@ ThreeViewShowersAlgorithm::ThreeViewShowersAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+ThreeViewShowersAlgorithm::~ThreeViewShowersAlgorithm()
+{
+    if (m_useSharedSlidingFitCache)
+        LArSlidingFitCacheHelper::Erase(this->GetPandora());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 const TwoDSlidingShowerFitResult &ThreeViewShowersAlgorithm::GetCachedSlidingFitResult(const Cluster *const pCluster) const
 {
     TwoDSlidingShowerFitResultMap::const_iterator iter = m_slidingFitResultMap.find(pCluster);
@@ -125,6 +135,16 @@ void ThreeViewShowersAlgorithm::PrepareInputClusters(ClusterList &preparedCluste
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode ThreeViewShowersAlgorithm::Reset()
+{
+    if (m_useSharedSlidingFitCache)
+        LArSlidingFitCacheHelper::Reset(this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeViewShowersAlgorithm::TidyUp()
 {
     m_slidingFitResultMap.clear();
@@ -136,6 +156,19 @@ void ThreeViewShowersAlgorithm::TidyUp()
 void ThreeViewShowersAlgorithm::AddToSlidingFitCache(const Cluster *const pCluster)
 {
     const float slidingFitPitch(LArGeometryHelper::GetWirePitch(this->GetPandora(), LArClusterHelper::GetClusterHitType(pCluster)));
+
+    if (m_useSharedSlidingFitCache)
+    {
+        const TwoDSlidingFitResult &showerFitResult(
+            LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), pCluster, m_slidingFitWindow, slidingFitPitch));
+        const TwoDSlidingShowerFitResult slidingShowerFitResult(pCluster, showerFitResult);
+
+        if (!m_slidingFitResultMap.insert(TwoDSlidingShowerFitResultMap::value_type(pCluster, slidingShowerFitResult)).second)
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+
+        return;
+    }
+
     const TwoDSlidingShowerFitResult slidingShowerFitResult(pCluster, m_slidingFitWindow, slidingFitPitch);
 
     if (!m_slidingFitResultMap.insert(TwoDSlidingShowerFitResultMap::value_type(pCluster, slidingShowerFitResult)).second)
@@ -166,6 +199,20 @@ void ThreeViewShowersAlgorithm::CalculateOverlapResult(const Cluster *const pClu
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool ThreeViewShowersAlgorithm::GetClusterXSpan(const Cluster *const pCluster, float &minX, float &maxX) const
+{
+    // ATTN Overlap results require the x extents of the shower fits to overlap
+    TwoDSlidingShowerFitResultMap::const_iterator iter = m_slidingFitResultMap.find(pCluster);
+
+    if (m_slidingFitResultMap.end() == iter)
+        return false;
+
+    iter->second.GetShowerFitResult().GetMinAndMaxX(minX, maxX);
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ThreeViewShowersAlgorithm::CalculateOverlapResult(
     const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW, ShowerOverlapResult &overlapResult)
 {
@@ -401,6 +448,9 @@ StatusCode ThreeViewShowersAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SlidingFitWindow", m_slidingFitWindow));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "UseSharedSlidingFitCache", m_useSharedSlidingFitCache));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "IgnoreUnavailableClusters", m_ignoreUnavailableClusters));
 
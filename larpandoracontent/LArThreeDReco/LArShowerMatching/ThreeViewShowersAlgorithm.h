@@ -36,6 +36,11 @@ public:
      */
     ThreeViewShowersAlgorithm();
 
+    /**
+     *  @brief  Destructor
+     */
+    ~ThreeViewShowersAlgorithm();
+
     /**
      *  @brief  Get a sliding shower fit result from the algorithm cache
      *
@@ -86,6 +91,7 @@ private:
         float m_nPoints;      ///< The number of sampling points to be used
     };
 
+    pandora::StatusCode Reset();
     void TidyUp();
 
     /**
@@ -103,6 +109,7 @@ private:
     void RemoveFromSlidingFitCache(const pandora::Cluster *const pCluster);
 
     void CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW);
+    bool GetClusterXSpan(const pandora::Cluster *const pCluster, float &minX, float &maxX) const;
 
     /**
      *  @brief  Calculate the overlap result for given group of clusters
@@ -153,6 +160,7 @@ private:
 
     unsigned int m_slidingFitWindow;                     ///< The layer window for the sliding linear fits
     TwoDSlidingShowerFitResultMap m_slidingFitResultMap; ///< The sliding shower fit result map
+    bool m_useSharedSlidingFitCache;                     ///< Whether to obtain full shower sliding fits via the event-scoped shared cache
 
     bool m_ignoreUnavailableClusters;  ///< Whether to ignore (skip-over) unavailable clusters
     unsigned int m_minClusterCaloHits; ///< The min number of hits in base cluster selection method
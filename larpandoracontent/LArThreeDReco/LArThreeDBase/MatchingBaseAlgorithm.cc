@@ -29,6 +29,13 @@ MatchingBaseAlgorithm::~MatchingBaseAlgorithm()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool MatchingBaseAlgorithm::GetClusterXSpan(const Cluster *const /*pCluster*/, float & /*minX*/, float & /*maxX*/) const
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void MatchingBaseAlgorithm::SelectInputClusters(const ClusterList *const pInputClusterList, ClusterList &selectedClusterList) const
 {
     if (!pInputClusterList)
@@ -99,6 +99,18 @@ public:
     virtual void CalculateOverlapResult(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2,
         const pandora::Cluster *const pCluster3 = nullptr) = 0;
 
+    /**
+     *  @brief  Get the x span of a cluster, used to skip cluster combinations before calling CalculateOverlapResult. An implementation
+     *          must ensure that CalculateOverlapResult has no effect for any combination containing two clusters with disjoint x spans.
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  minX to receive the minimum x coordinate
+     *  @param  maxX to receive the maximum x coordinate
+     *
+     *  @return whether an x span is available, otherwise the cluster cannot be excluded from any combination
+     */
+    virtual bool GetClusterXSpan(const pandora::Cluster *const pCluster, float &minX, float &maxX) const;
+
     /**
      *  @brief  Select a subset of input clusters for processing in this algorithm
      *
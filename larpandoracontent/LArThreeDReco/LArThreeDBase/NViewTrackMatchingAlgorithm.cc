@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
 #include "larpandoracontent/LArObjects/LArTrackOverlapResult.h"
@@ -27,6 +28,7 @@ namespace lar_content
 template <typename T>
 NViewTrackMatchingAlgorithm<T>::NViewTrackMatchingAlgorithm() :
     m_slidingFitWindow(20),
+    m_useSharedSlidingFitCache(false),
     m_minClusterCaloHits(5),
     m_minClusterLengthSquared(3.f * 3.f)
 {
@@ -37,6 +39,8 @@ NViewTrackMatchingAlgorithm<T>::NViewTrackMatchingAlgorithm() :
 template <typename T>
 NViewTrackMatchingAlgorithm<T>::~NViewTrackMatchingAlgorithm()
 {
+    if (m_useSharedSlidingFitCache)
+        LArSlidingFitCacheHelper::Erase(this->GetPandora());
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -255,6 +259,18 @@ template <typename T>
 void NViewTrackMatchingAlgorithm<T>::AddToSlidingFitCache(const Cluster *const pCluster)
 {
     const float slidingFitPitch(LArGeometryHelper::GetWirePitch(this->GetPandora(), LArClusterHelper::GetClusterHitType(pCluster)));
+
+    if (m_useSharedSlidingFitCache)
+    {
+        const TwoDSlidingFitResult &slidingFitResult(
+            LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), pCluster, m_slidingFitWindow, slidingFitPitch));
+
+        if (!m_slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(pCluster, slidingFitResult)).second)
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+
+        return;
+    }
+
     const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitWindow, slidingFitPitch);
 
     if (!m_slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(pCluster, slidingFitResult)).second)
@@ -274,6 +290,17 @@ void NViewTrackMatchingAlgorithm<T>::RemoveFromSlidingFitCache(const Cluster *co
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+StatusCode NViewTrackMatchingAlgorithm<T>::Reset()
+{
+    if (m_useSharedSlidingFitCache)
+        LArSlidingFitCacheHelper::Reset(this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void NViewTrackMatchingAlgorithm<T>::TidyUp()
 {
@@ -289,6 +316,9 @@ StatusCode NViewTrackMatchingAlgorithm<T>::ReadSettings(const TiXmlHandle xmlHan
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SlidingFitWindow", m_slidingFitWindow));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "UseSharedSlidingFitCache", m_useSharedSlidingFitCache));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MinClusterCaloHits", m_minClusterCaloHits));
 
@@ -101,12 +101,14 @@ protected:
      */
     void RemoveFromSlidingFitCache(const pandora::Cluster *const pCluster);
 
+    virtual pandora::StatusCode Reset();
     virtual void TidyUp();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
 private:
     unsigned int m_slidingFitWindow;               ///< The layer window for the sliding linear fits
     TwoDSlidingFitResultMap m_slidingFitResultMap; ///< The sliding fit result map
+    bool m_useSharedSlidingFitCache;               ///< Whether to obtain sliding fit results via the event-scoped shared cache
 
     unsigned int m_minClusterCaloHits; ///< The min number of hits in base cluster selection method
     float m_minClusterLengthSquared;   ///< The min length (squared) in base cluster selection method
@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
 
 #include "larpandoracontent/LArObjects/LArShowerOverlapResult.h"
 #include "larpandoracontent/LArObjects/LArTrackOverlapResult.h"
@@ -16,6 +17,8 @@
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/MatchingBaseAlgorithm.h"
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/ThreeViewMatchingControl.h"
 
+#include <algorithm>
+
 using namespace pandora;
 
 namespace lar_content
@@ -26,7 +29,9 @@ ThreeViewMatchingControl<T>::ThreeViewMatchingControl(MatchingBaseAlgorithm *con
     NViewMatchingControl(pAlgorithm),
     m_pInputClusterListU(nullptr),
     m_pInputClusterListV(nullptr),
-    m_pInputClusterListW(nullptr)
+    m_pInputClusterListW(nullptr),
+    m_nOverlapThreads(1),
+    m_pOverlapCalculator(nullptr)
 {
 }
 
@@ -62,32 +67,54 @@ void ThreeViewMatchingControl<T>::UpdateForNewCluster(const Cluster *const pNewC
 
     clusterList.push_back(pNewCluster);
 
-    const ClusterList &clusterList2((TPC_VIEW_U == hitType) ? m_clusterListV : m_clusterListU);
-    const ClusterList &clusterList3((TPC_VIEW_W == hitType) ? m_clusterListV : m_clusterListW);
+    // ATTN Maintain the hit-ordered cluster vectors incrementally, rather than sorting the other views for every new cluster
+    ClusterVector &clusterVector(
+        (TPC_VIEW_U == hitType) ? m_clusterVectorU : (TPC_VIEW_V == hitType) ? m_clusterVectorV : m_clusterVectorW);
+    clusterVector.insert(
+        std::upper_bound(clusterVector.begin(), clusterVector.end(), pNewCluster, LArClusterHelper::SortByNHits), pNewCluster);
+
+    const ClusterVector &clusterVector2((TPC_VIEW_U == hitType) ? m_clusterVectorV : m_clusterVectorU);
+    const ClusterVector &clusterVector3((TPC_VIEW_W == hitType) ? m_clusterVectorV : m_clusterVectorW);
+
+    const ClusterXSpan newXSpan(this->GetClusterXSpan(pNewCluster));
 
-    ClusterVector clusterVector2(clusterList2.begin(), clusterList2.end());
-    ClusterVector clusterVector3(clusterList3.begin(), clusterList3.end());
-    std::sort(clusterVector2.begin(), clusterVector2.end(), LArClusterHelper::SortByNHits);
-    std::sort(clusterVector3.begin(), clusterVector3.end(), LArClusterHelper::SortByNHits);
+    ClusterXSpanVector xSpanVector2, xSpanVector3;
+    this->GetClusterXSpans(clusterVector2, xSpanVector2);
+    this->GetClusterXSpans(clusterVector3, xSpanVector3);
 
-    for (const Cluster *const pCluster2 : clusterVector2)
+    ClusterXSpanVector overlappingXSpanVector2, overlappingXSpanVector3;
+    this->SelectOverlappingXSpans(xSpanVector2, newXSpan, overlappingXSpanVector2);
+    this->SelectOverlappingXSpans(xSpanVector3, newXSpan, overlappingXSpanVector3);
+
+    ClusterTripletVector clusterTripletVector;
+
+    for (const ClusterXSpan &xSpan2 : overlappingXSpanVector2)
     {
-        for (const Cluster *const pCluster3 : clusterVector3)
+        const Cluster *const pCluster2(xSpan2.m_pCluster);
+
+        for (const ClusterXSpan &xSpan3 : overlappingXSpanVector3)
         {
+            if (!ThreeViewMatchingControl<T>::IsXOverlapPossible(xSpan2, xSpan3))
+                continue;
+
+            const Cluster *const pCluster3(xSpan3.m_pCluster);
+
             if (TPC_VIEW_U == hitType)
             {
-                m_pAlgorithm->CalculateOverlapResult(pNewCluster, pCluster2, pCluster3);
+                clusterTripletVector.push_back(ClusterTriplet{pNewCluster, pCluster2, pCluster3});
             }
             else if (TPC_VIEW_V == hitType)
             {
-                m_pAlgorithm->CalculateOverlapResult(pCluster2, pNewCluster, pCluster3);
+                clusterTripletVector.push_back(ClusterTriplet{pCluster2, pNewCluster, pCluster3});
             }
             else
             {
-                m_pAlgorithm->CalculateOverlapResult(pCluster2, pCluster3, pNewCluster);
+                clusterTripletVector.push_back(ClusterTriplet{pCluster2, pCluster3, pNewCluster});
             }
         }
     }
+
+    this->CalculateOverlapResults(clusterTripletVector);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -108,6 +135,14 @@ void ThreeViewMatchingControl<T>::UpdateUponDeletion(const Cluster *const pDelet
     if (m_clusterListW.end() != iterW)
         m_clusterListW.erase(iterW);
 
+    for (ClusterVector *const pClusterVector : {&m_clusterVectorU, &m_clusterVectorV, &m_clusterVectorW})
+    {
+        ClusterVector::iterator iter = std::find(pClusterVector->begin(), pClusterVector->end(), pDeletedCluster);
+
+        if (pClusterVector->end() != iter)
+            pClusterVector->erase(iter);
+    }
+
     m_overlapTensor.RemoveCluster(pDeletedCluster);
 }
 
@@ -211,6 +246,10 @@ void ThreeViewMatchingControl<T>::TidyUp()
     m_clusterListU.clear();
     m_clusterListV.clear();
     m_clusterListW.clear();
+
+    m_clusterVectorU.clear();
+    m_clusterVectorV.clear();
+    m_clusterVectorW.clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -218,21 +257,37 @@ void ThreeViewMatchingControl<T>::TidyUp()
 template <typename T>
 void ThreeViewMatchingControl<T>::PerformMainLoop()
 {
-    ClusterVector clusterVectorU(m_clusterListU.begin(), m_clusterListU.end());
-    ClusterVector clusterVectorV(m_clusterListV.begin(), m_clusterListV.end());
-    ClusterVector clusterVectorW(m_clusterListW.begin(), m_clusterListW.end());
-    std::sort(clusterVectorU.begin(), clusterVectorU.end(), LArClusterHelper::SortByNHits);
-    std::sort(clusterVectorV.begin(), clusterVectorV.end(), LArClusterHelper::SortByNHits);
-    std::sort(clusterVectorW.begin(), clusterVectorW.end(), LArClusterHelper::SortByNHits);
-
-    for (const Cluster *const pClusterU : clusterVectorU)
+    m_clusterVectorU.assign(m_clusterListU.begin(), m_clusterListU.end());
+    m_clusterVectorV.assign(m_clusterListV.begin(), m_clusterListV.end());
+    m_clusterVectorW.assign(m_clusterListW.begin(), m_clusterListW.end());
+    std::sort(m_clusterVectorU.begin(), m_clusterVectorU.end(), LArClusterHelper::SortByNHits);
+    std::sort(m_clusterVectorV.begin(), m_clusterVectorV.end(), LArClusterHelper::SortByNHits);
+    std::sort(m_clusterVectorW.begin(), m_clusterVectorW.end(), LArClusterHelper::SortByNHits);
+
+    ClusterXSpanVector xSpanVectorU, xSpanVectorV, xSpanVectorW;
+    this->GetClusterXSpans(m_clusterVectorU, xSpanVectorU);
+    this->GetClusterXSpans(m_clusterVectorV, xSpanVectorV);
+    this->GetClusterXSpans(m_clusterVectorW, xSpanVectorW);
+
+    ClusterTripletVector clusterTripletVector;
+
+    for (const ClusterXSpan &xSpanU : xSpanVectorU)
     {
-        for (const Cluster *const pClusterV : clusterVectorV)
+        ClusterXSpanVector overlappingXSpanVectorV, overlappingXSpanVectorW;
+        this->SelectOverlappingXSpans(xSpanVectorV, xSpanU, overlappingXSpanVectorV);
+        this->SelectOverlappingXSpans(xSpanVectorW, xSpanU, overlappingXSpanVectorW);
+
+        for (const ClusterXSpan &xSpanV : overlappingXSpanVectorV)
         {
-            for (const Cluster *const pClusterW : clusterVectorW)
-                m_pAlgorithm->CalculateOverlapResult(pClusterU, pClusterV, pClusterW);
+            for (const ClusterXSpan &xSpanW : overlappingXSpanVectorW)
+            {
+                if (ThreeViewMatchingControl<T>::IsXOverlapPossible(xSpanV, xSpanW))
+                    clusterTripletVector.push_back(ClusterTriplet{xSpanU.m_pCluster, xSpanV.m_pCluster, xSpanW.m_pCluster});
+            }
         }
     }
+
+    this->CalculateOverlapResults(clusterTripletVector);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -244,9 +299,122 @@ StatusCode ThreeViewMatchingControl<T>::ReadSettings(const TiXmlHandle xmlHandle
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListNameV", m_inputClusterListNameV));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListNameW", m_inputClusterListNameW));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NOverlapThreads", m_nOverlapThreads));
+
+    if (1 != m_nOverlapThreads)
+    {
+        m_pOverlapCalculator = dynamic_cast<const ThreeViewOverlapCalculator<T> *>(m_pAlgorithm);
+
+        if (!m_pOverlapCalculator)
+        {
+            std::cout << "ThreeViewMatchingControl: NOverlapThreads requires an algorithm able to calculate overlap results concurrently"
+                      << std::endl;
+            return STATUS_CODE_INVALID_PARAMETER;
+        }
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+typename ThreeViewMatchingControl<T>::ClusterXSpan ThreeViewMatchingControl<T>::GetClusterXSpan(const Cluster *const pCluster) const
+{
+    ClusterXSpan clusterXSpan{pCluster, false, 0.f, 0.f};
+    clusterXSpan.m_hasXSpan = m_pAlgorithm->GetClusterXSpan(pCluster, clusterXSpan.m_minX, clusterXSpan.m_maxX);
+
+    return clusterXSpan;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void ThreeViewMatchingControl<T>::GetClusterXSpans(const ClusterVector &clusterVector, ClusterXSpanVector &clusterXSpanVector) const
+{
+    clusterXSpanVector.reserve(clusterXSpanVector.size() + clusterVector.size());
+
+    for (const Cluster *const pCluster : clusterVector)
+        clusterXSpanVector.push_back(this->GetClusterXSpan(pCluster));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void ThreeViewMatchingControl<T>::SelectOverlappingXSpans(
+    const ClusterXSpanVector &clusterXSpanVector, const ClusterXSpan &targetXSpan, ClusterXSpanVector &overlappingXSpanVector) const
+{
+    for (const ClusterXSpan &clusterXSpan : clusterXSpanVector)
+    {
+        if (ThreeViewMatchingControl<T>::IsXOverlapPossible(clusterXSpan, targetXSpan))
+            overlappingXSpanVector.push_back(clusterXSpan);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+bool ThreeViewMatchingControl<T>::IsXOverlapPossible(const ClusterXSpan &xSpan1, const ClusterXSpan &xSpan2)
+{
+    if (!xSpan1.m_hasXSpan || !xSpan2.m_hasXSpan)
+        return true;
+
+    return !((xSpan1.m_maxX < xSpan2.m_minX) || (xSpan2.m_maxX < xSpan1.m_minX));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void ThreeViewMatchingControl<T>::CalculateOverlapResults(const ClusterTripletVector &clusterTripletVector)
+{
+    if (!m_pOverlapCalculator)
+    {
+        for (const ClusterTriplet &clusterTriplet : clusterTripletVector)
+            m_pAlgorithm->CalculateOverlapResult(clusterTriplet.m_pClusterU, clusterTriplet.m_pClusterV, clusterTriplet.m_pClusterW);
+
+        return;
+    }
+
+    // ATTN Calculations only read cluster information and caches populated before the main loop, so can run concurrently. Results and
+    // exceptions are kept per triplet, then applied serially in triplet order, so the tensor contents (and the point at which any exception
+    // propagates) match the serial calculation exactly.
+    const unsigned int nTriplets(clusterTripletVector.size());
+    TripletOverlapResultVector tripletOverlapResultVector(nTriplets, TripletOverlapResult{false, T(), nullptr});
+
+    LArThreadingHelper::RunTasks(LArThreadingHelper::GetNThreads(m_nOverlapThreads, nTriplets), nTriplets,
+        [&](const unsigned int /*threadIndex*/, const unsigned int tripletIndex)
+        {
+            const ClusterTriplet &clusterTriplet(clusterTripletVector.at(tripletIndex));
+            TripletOverlapResult &tripletOverlapResult(tripletOverlapResultVector.at(tripletIndex));
+
+            try
+            {
+                tripletOverlapResult.m_isStored = m_pOverlapCalculator->CalculateThreadSafeOverlapResult(clusterTriplet.m_pClusterU,
+                    clusterTriplet.m_pClusterV, clusterTriplet.m_pClusterW, tripletOverlapResult.m_overlapResult);
+            }
+            catch (...)
+            {
+                tripletOverlapResult.m_exception = std::current_exception();
+            }
+        });
+
+    for (unsigned int tripletIndex = 0; tripletIndex < nTriplets; ++tripletIndex)
+    {
+        const ClusterTriplet &clusterTriplet(clusterTripletVector.at(tripletIndex));
+        const TripletOverlapResult &tripletOverlapResult(tripletOverlapResultVector.at(tripletIndex));
+
+        if (tripletOverlapResult.m_exception)
+            std::rethrow_exception(tripletOverlapResult.m_exception);
+
+        if (tripletOverlapResult.m_isStored)
+        {
+            m_overlapTensor.SetOverlapResult(
+                clusterTriplet.m_pClusterU, clusterTriplet.m_pClusterV, clusterTriplet.m_pClusterW, tripletOverlapResult.m_overlapResult);
+        }
+    }
+}
+
 template class ThreeViewMatchingControl<float>;
 template class ThreeViewMatchingControl<TransverseOverlapResult>;
 template class ThreeViewMatchingControl<LongitudinalOverlapResult>;
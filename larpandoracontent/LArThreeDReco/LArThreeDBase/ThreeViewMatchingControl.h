@@ -12,9 +12,40 @@
 
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/NViewMatchingControl.h"
 
+#include <exception>
+
 namespace lar_content
 {
 
+/**
+ *  @brief  ThreeViewOverlapCalculator class, an interface for matching algorithms able to calculate overlap results concurrently
+ */
+template <typename T>
+class ThreeViewOverlapCalculator
+{
+public:
+    /**
+     *  @brief  Destructor
+     */
+    virtual ~ThreeViewOverlapCalculator() = default;
+
+    /**
+     *  @brief  Calculate the overlap result for a cluster triplet, without storing it. Implementations may be called concurrently for
+     *          different triplets, so must only read cluster information and caches populated before the main loop begins.
+     *
+     *  @param  pClusterU the cluster from the U view
+     *  @param  pClusterV the cluster from the V view
+     *  @param  pClusterW the cluster from the W view
+     *  @param  overlapResult to receive the overlap result
+     *
+     *  @return whether the overlap result should be stored in the overlap tensor
+     */
+    virtual bool CalculateThreadSafeOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV,
+        const pandora::Cluster *const pClusterW, T &overlapResult) const = 0;
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  ThreeViewMatchingControl class
  */
@@ -44,6 +75,46 @@ public:
     TensorType &GetOverlapTensor();
 
 private:
+    /**
+     *  @brief  ClusterXSpan class, describing a cluster and its x span as provided by the matching algorithm
+     */
+    class ClusterXSpan
+    {
+    public:
+        const pandora::Cluster *m_pCluster; ///< The address of the cluster
+        bool m_hasXSpan;                    ///< Whether the x span is available, otherwise the cluster cannot be excluded
+        float m_minX;                       ///< The minimum x coordinate
+        float m_maxX;                       ///< The maximum x coordinate
+    };
+
+    typedef std::vector<ClusterXSpan> ClusterXSpanVector;
+
+    /**
+     *  @brief  ClusterTriplet class, describing a combination of clusters from the three views
+     */
+    class ClusterTriplet
+    {
+    public:
+        const pandora::Cluster *m_pClusterU; ///< The address of the cluster from the U view
+        const pandora::Cluster *m_pClusterV; ///< The address of the cluster from the V view
+        const pandora::Cluster *m_pClusterW; ///< The address of the cluster from the W view
+    };
+
+    typedef std::vector<ClusterTriplet> ClusterTripletVector;
+
+    /**
+     *  @brief  TripletOverlapResult class, holding the outcome of a concurrent overlap result calculation for a cluster triplet
+     */
+    class TripletOverlapResult
+    {
+    public:
+        bool m_isStored;                ///< Whether the overlap result should be stored in the overlap tensor
+        T m_overlapResult;              ///< The overlap result
+        std::exception_ptr m_exception; ///< Any exception raised by the overlap result calculation
+    };
+
+    typedef std::vector<TripletOverlapResult> TripletOverlapResultVector;
+
     void UpdateForNewCluster(const pandora::Cluster *const pNewCluster);
     void UpdateUponDeletion(const pandora::Cluster *const pDeletedCluster);
     const std::string &GetClusterListName(const pandora::HitType hitType) const;
@@ -55,6 +126,51 @@ private:
     void TidyUp();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
+    /**
+     *  @brief  Get the x span of a cluster, as provided by the matching algorithm
+     *
+     *  @param  pCluster address of the cluster
+     *
+     *  @return the cluster x span
+     */
+    ClusterXSpan GetClusterXSpan(const pandora::Cluster *const pCluster) const;
+
+    /**
+     *  @brief  Get the x spans of a vector of clusters, as provided by the matching algorithm
+     *
+     *  @param  clusterVector the cluster vector
+     *  @param  clusterXSpanVector to receive the cluster x spans, in the order of the cluster vector
+     */
+    void GetClusterXSpans(const pandora::ClusterVector &clusterVector, ClusterXSpanVector &clusterXSpanVector) const;
+
+    /**
+     *  @brief  Select the cluster x spans that overlap a target cluster x span, preserving their order
+     *
+     *  @param  clusterXSpanVector the input cluster x spans
+     *  @param  targetXSpan the target cluster x span
+     *  @param  overlappingXSpanVector to receive the overlapping cluster x spans
+     */
+    void SelectOverlappingXSpans(
+        const ClusterXSpanVector &clusterXSpanVector, const ClusterXSpan &targetXSpan, ClusterXSpanVector &overlappingXSpanVector) const;
+
+    /**
+     *  @brief  Whether a pair of cluster x spans could overlap, i.e. whether the pair cannot be excluded from any combination
+     *
+     *  @param  xSpan1 the first cluster x span
+     *  @param  xSpan2 the second cluster x span
+     *
+     *  @return boolean
+     */
+    static bool IsXOverlapPossible(const ClusterXSpan &xSpan1, const ClusterXSpan &xSpan2);
+
+    /**
+     *  @brief  Calculate the overlap results for a list of cluster triplets and store them in the overlap tensor, in the order of the list.
+     *          If concurrent calculation is enabled, results are calculated on a pool of threads and only stored once all are available.
+     *
+     *  @param  clusterTripletVector the cluster triplet vector
+     */
+    void CalculateOverlapResults(const ClusterTripletVector &clusterTripletVector);
+
     const pandora::ClusterList *m_pInputClusterListU; ///< Address of the input cluster list U
     const pandora::ClusterList *m_pInputClusterListV; ///< Address of the input cluster list V
     const pandora::ClusterList *m_pInputClusterListW; ///< Address of the input cluster list W
@@ -63,12 +179,19 @@ private:
     pandora::ClusterList m_clusterListV; ///< The selected modified cluster list V
     pandora::ClusterList m_clusterListW; ///< The selected modified cluster list W
 
+    pandora::ClusterVector m_clusterVectorU; ///< The selected modified clusters U, sorted by number of hits
+    pandora::ClusterVector m_clusterVectorV; ///< The selected modified clusters V, sorted by number of hits
+    pandora::ClusterVector m_clusterVectorW; ///< The selected modified clusters W, sorted by number of hits
+
     TensorType m_overlapTensor; ///< The overlap tensor
 
     std::string m_inputClusterListNameU; ///< The name of the view U cluster list
     std::string m_inputClusterListNameV; ///< The name of the view V cluster list
     std::string m_inputClusterListNameW; ///< The name of the view W cluster list
 
+    unsigned int m_nOverlapThreads;                           ///< The number of overlap calculation threads (0 for hardware concurrency)
+    const ThreeViewOverlapCalculator<T> *m_pOverlapCalculator; ///< The concurrent overlap calculator, if concurrent calculation is enabled
+
     friend class ThreeViewTrackFragmentsAlgorithm; ///< ATTN This is for legacy purposes only
     friend class ThreeViewDeltaRayMatchingAlgorithm;
 
@@ -35,17 +35,43 @@ ThreeViewTransverseTracksAlgorithm::ThreeViewTransverseTracksAlgorithm() :
 void ThreeViewTransverseTracksAlgorithm::CalculateOverlapResult(const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW)
 {
     TransverseOverlapResult overlapResult;
+
+    if (this->CalculateThreadSafeOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult))
+        this->GetMatchingControl().GetOverlapTensor().SetOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ThreeViewTransverseTracksAlgorithm::CalculateThreadSafeOverlapResult(const Cluster *const pClusterU, const Cluster *const pClusterV,
+    const Cluster *const pClusterW, TransverseOverlapResult &overlapResult) const
+{
     PANDORA_THROW_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, this->CalculateOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult));
 
-    if (overlapResult.IsInitialized())
-        this->GetMatchingControl().GetOverlapTensor().SetOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult);
+    return overlapResult.IsInitialized();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ThreeViewTransverseTracksAlgorithm::GetClusterXSpan(const Cluster *const pCluster, float &minX, float &maxX) const
+{
+    // ATTN Overlap results require the x extents of fit segments to overlap, and these lie within the x extent of the sliding fit
+    try
+    {
+        this->GetCachedSlidingFitResult(pCluster).GetMinAndMaxX(minX, maxX);
+    }
+    catch (StatusCodeException &)
+    {
+        return false;
+    }
+
+    return true;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode ThreeViewTransverseTracksAlgorithm::CalculateOverlapResult(
-    const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW, TransverseOverlapResult &overlapResult)
+StatusCode ThreeViewTransverseTracksAlgorithm::CalculateOverlapResult(const Cluster *const pClusterU, const Cluster *const pClusterV,
+    const Cluster *const pClusterW, TransverseOverlapResult &overlapResult) const
 {
     const TwoDSlidingFitResult &slidingFitResultU(this->GetCachedSlidingFitResult(pClusterU));
     const TwoDSlidingFitResult &slidingFitResultV(this->GetCachedSlidingFitResult(pClusterV));
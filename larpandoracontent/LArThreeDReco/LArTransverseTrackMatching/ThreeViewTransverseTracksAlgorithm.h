@@ -26,7 +26,8 @@ class TransverseTensorTool;
 /**
  *  @brief  ThreeViewTransverseTracksAlgorithm class
  */
-class ThreeViewTransverseTracksAlgorithm : public NViewTrackMatchingAlgorithm<ThreeViewMatchingControl<TransverseOverlapResult>>
+class ThreeViewTransverseTracksAlgorithm : public NViewTrackMatchingAlgorithm<ThreeViewMatchingControl<TransverseOverlapResult>>,
+                                           public ThreeViewOverlapCalculator<TransverseOverlapResult>
 {
 public:
     typedef NViewTrackMatchingAlgorithm<ThreeViewMatchingControl<TransverseOverlapResult>> BaseAlgorithm;
@@ -42,6 +43,9 @@ private:
     typedef std::map<unsigned int, FitSegmentMatrix> FitSegmentTensor;
 
     void CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW);
+    bool GetClusterXSpan(const pandora::Cluster *const pCluster, float &minX, float &maxX) const;
+    bool CalculateThreadSafeOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV,
+        const pandora::Cluster *const pClusterW, TransverseOverlapResult &overlapResult) const;
 
     /**
      *  @brief  Calculate the overlap result for given group of clusters
@@ -54,7 +58,7 @@ private:
      *  @return statusCode, faster than throwing in regular use-cases
      */
     pandora::StatusCode CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV,
-        const pandora::Cluster *const pClusterW, TransverseOverlapResult &overlapResult);
+        const pandora::Cluster *const pClusterW, TransverseOverlapResult &overlapResult) const;
 
     /**
      *  @brief  Get the number of matched points for three fit segments and accompanying sliding fit results
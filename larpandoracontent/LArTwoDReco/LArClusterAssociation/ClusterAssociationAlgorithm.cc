@@ -36,6 +36,9 @@ StatusCode ClusterAssociationAlgorithm::Run()
     ClusterAssociationMap clusterAssociationMap;
     this->PopulateClusterAssociationMap(clusterVector, clusterAssociationMap);
 
+    // ATTN The clusterVector may end up with dangling pointers; liveness is tracked by removing clusters from this set as they are deleted
+    m_liveClusters.clear();
+    m_liveClusters.insert(clusterVector.begin(), clusterVector.end());
     m_mergeMade = true;
 
     while (m_mergeMade)
@@ -47,8 +50,7 @@ StatusCode ClusterAssociationAlgorithm::Run()
 
             for (const Cluster *const pCluster : clusterVector)
             {
-                // ATTN The clusterVector may end up with dangling pointers; only protected by this check against managed cluster list
-                if (pClusterList->end() == std::find(pClusterList->begin(), pClusterList->end(), pCluster))
+                if (!m_liveClusters.count(pCluster))
                     continue;
 
                 this->UnambiguousPropagation(pCluster, true, clusterAssociationMap);
@@ -113,6 +115,7 @@ void ClusterAssociationAlgorithm::UnambiguousPropagation(const Cluster *const pC
     this->UpdateForUnambiguousMerge(pClusterToEnlarge, pClusterToDelete, isForward, clusterAssociationMap);
 
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pClusterToEnlarge, pClusterToDelete));
+    (void)m_liveClusters.erase(pClusterToDelete);
     m_mergeMade = true;
 
     this->UnambiguousPropagation(pClusterToEnlarge, isForward, clusterAssociationMap);
@@ -156,6 +159,7 @@ void ClusterAssociationAlgorithm::AmbiguousPropagation(const Cluster *const pClu
         this->UpdateForAmbiguousMerge(*dIter, clusterAssociationMap);
 
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pCluster, *dIter));
+        (void)m_liveClusters.erase(*dIter);
         m_mergeMade = true;
         *dIter = NULL;
     }
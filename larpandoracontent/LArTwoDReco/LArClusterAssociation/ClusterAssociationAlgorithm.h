@@ -121,6 +121,7 @@ private:
         const bool isForward, const pandora::Cluster *&pExtremalCluster, pandora::ClusterSet &clusterSet) const;
 
     mutable bool m_mergeMade;
+    mutable pandora::ClusterSet m_liveClusters; ///< The clean clusters not yet deleted by merges in the current invocation
 
     bool m_resolveAmbiguousAssociations; ///< Whether to resolve ambiguous associations
 };
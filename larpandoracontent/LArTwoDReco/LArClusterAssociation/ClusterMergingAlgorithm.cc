@@ -17,6 +17,13 @@ using namespace pandora;
 namespace lar_content
 {
 
+ClusterMergingAlgorithm::ClusterMergingAlgorithm() :
+    m_useIncrementalMergeMap(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterMergingAlgorithm::Run()
 {
     const ClusterList *pClusterList = NULL;
@@ -39,6 +46,9 @@ StatusCode ClusterMergingAlgorithm::Run()
         return STATUS_CODE_SUCCESS;
     }
 
+    ClusterMergeMap associationMap;
+    ClusterSet testedClusters, modifiedClusters;
+
     while (true)
     {
         ClusterVector unsortedVector, clusterVector;
@@ -46,11 +56,25 @@ StatusCode ClusterMergingAlgorithm::Run()
         this->GetSortedListOfCleanClusters(unsortedVector, clusterVector);
 
         ClusterMergeMap clusterMergeMap;
-        this->PopulateClusterMergeMap(clusterVector, clusterMergeMap);
+
+        if (m_useIncrementalMergeMap)
+        {
+            this->UpdateClusterMergeMap(clusterVector, modifiedClusters, associationMap, testedClusters, clusterMergeMap);
+        }
+        else
+        {
+            this->PopulateClusterMergeMap(clusterVector, clusterMergeMap);
+        }
 
         if (clusterMergeMap.empty())
             break;
 
+        // ATTN Every associated cluster is either a merge seed or merged (and deleted), so must be retested in the next iteration
+        modifiedClusters.clear();
+
+        for (const ClusterMergeMap::value_type &mapEntry : clusterMergeMap)
+            (void)modifiedClusters.insert(mapEntry.first);
+
         this->MergeClusters(clusterVector, clusterMergeMap);
     }
 
@@ -59,6 +83,20 @@ StatusCode ClusterMergingAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool ClusterMergingAlgorithm::SupportsIncrementalMergeMap() const
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ClusterMergingAlgorithm::IsPairwiseAssociated(const Cluster *const, const Cluster *const) const
+{
+    throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ClusterMergingAlgorithm::MergeClusters(ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap) const
 {
     ClusterSet clusterVetoList;
@@ -159,11 +197,101 @@ void ClusterMergingAlgorithm::GetSortedListOfCleanClusters(const ClusterVector &
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ClusterMergingAlgorithm::UpdateClusterMergeMap(const ClusterVector &clusterVector, const ClusterSet &modifiedClusters,
+    ClusterMergeMap &associationMap, ClusterSet &testedClusters, ClusterMergeMap &clusterMergeMap) const
+{
+    std::unordered_map<const Cluster *, unsigned int> clusterToIndexMap;
+
+    for (unsigned int i = 0; i < clusterVector.size(); ++i)
+        clusterToIndexMap[clusterVector.at(i)] = i;
+
+    // Forget clusters that have been modified or have left the clean list, including those merged away
+    ClusterSet staleClusters;
+
+    for (const Cluster *const pCluster : testedClusters)
+    {
+        if (modifiedClusters.count(pCluster) || !clusterToIndexMap.count(pCluster))
+            (void)staleClusters.insert(pCluster);
+    }
+
+    for (const Cluster *const pStaleCluster : staleClusters)
+    {
+        ClusterMergeMap::iterator staleIter(associationMap.find(pStaleCluster));
+
+        if (associationMap.end() != staleIter)
+        {
+            for (const Cluster *const pAssociatedCluster : staleIter->second)
+            {
+                ClusterMergeMap::iterator iter(associationMap.find(pAssociatedCluster));
+
+                if (associationMap.end() != iter)
+                    iter->second.remove(pStaleCluster);
+            }
+
+            associationMap.erase(staleIter);
+        }
+
+        (void)testedClusters.erase(pStaleCluster);
+    }
+
+    // Test each pair involving an untested cluster exactly once, against all tested clusters and all later untested clusters
+    for (unsigned int i = 0; i < clusterVector.size(); ++i)
+    {
+        const Cluster *const pClusterI(clusterVector.at(i));
+
+        if (testedClusters.count(pClusterI))
+            continue;
+
+        for (unsigned int j = 0; j < clusterVector.size(); ++j)
+        {
+            const Cluster *const pClusterJ(clusterVector.at(j));
+
+            if ((i == j) || ((j < i) && !testedClusters.count(pClusterJ)))
+                continue;
+
+            const bool isAssociated(
+                (i < j) ? this->IsPairwiseAssociated(pClusterI, pClusterJ) : this->IsPairwiseAssociated(pClusterJ, pClusterI));
+
+            if (isAssociated)
+            {
+                associationMap[pClusterI].push_back(pClusterJ);
+                associationMap[pClusterJ].push_back(pClusterI);
+            }
+        }
+    }
+
+    for (const Cluster *const pCluster : clusterVector)
+        (void)testedClusters.insert(pCluster);
+
+    // Order associations by clean cluster vector index, as would a full pairwise population of the merge map
+    for (ClusterMergeMap::value_type &mapEntry : associationMap)
+    {
+        if (mapEntry.second.empty())
+            continue;
+
+        ClusterList &associatedClusters(clusterMergeMap[mapEntry.first]);
+        associatedClusters = mapEntry.second;
+        associatedClusters.sort([&clusterToIndexMap](const Cluster *const pLhs, const Cluster *const pRhs)
+            { return clusterToIndexMap.at(pLhs) < clusterToIndexMap.at(pRhs); });
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterMergingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListName", m_inputClusterListName));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "UseIncrementalMergeMap", m_useIncrementalMergeMap));
+
+    if (m_useIncrementalMergeMap && !this->SupportsIncrementalMergeMap())
+    {
+        std::cout << "ClusterMergingAlgorithm: incremental merge map maintenance is not supported by this algorithm" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
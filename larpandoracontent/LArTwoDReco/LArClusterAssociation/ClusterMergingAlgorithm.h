@@ -20,6 +20,12 @@ namespace lar_content
  */
 class ClusterMergingAlgorithm : public pandora::Algorithm
 {
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    ClusterMergingAlgorithm();
+
 protected:
     virtual pandora::StatusCode Run();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -42,6 +48,26 @@ protected:
      */
     virtual void PopulateClusterMergeMap(const pandora::ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap) const = 0;
 
+    /**
+     *  @brief  Whether the algorithm supports incremental maintenance of the cluster merge map. If so, PopulateClusterMergeMap must be
+     *          equivalent to testing each pair of clean clusters with IsPairwiseAssociated (earlier cluster in the clean cluster vector
+     *          first) and recording an association in the merge map entries of both clusters. Both this test and the selection of clean
+     *          clusters must depend only upon the clusters concerned.
+     *
+     *  @return boolean
+     */
+    virtual bool SupportsIncrementalMergeMap() const;
+
+    /**
+     *  @brief  Decide whether a pair of clean clusters is associated, for algorithms supporting incremental merge map maintenance
+     *
+     *  @param  pCluster1 address of the cluster appearing first in the clean cluster vector
+     *  @param  pCluster2 address of the cluster appearing second in the clean cluster vector
+     *
+     *  @return boolean
+     */
+    virtual bool IsPairwiseAssociated(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2) const;
+
     /**
      *  @brief  Merge associated clusters
      *
@@ -81,6 +107,22 @@ protected:
     void GetSortedListOfCleanClusters(const pandora::ClusterVector &inputClusters, pandora::ClusterVector &outputClusters) const;
 
     std::string m_inputClusterListName; ///< The name of the input cluster list. If not specified, will access current list.
+    bool m_useIncrementalMergeMap;      ///< Whether to retest associations only for clusters new to the clean list or touched by a merge
+
+private:
+    /**
+     *  @brief  Update the record of pairwise cluster associations to reflect the current clean clusters, testing only those pairs that
+     *          involve a cluster that is new to the clean cluster vector or that was modified by the last round of merges, and then
+     *          extract the cluster merge map, with the same ordering as a full pairwise PopulateClusterMergeMap
+     *
+     *  @param  clusterVector the vector of clean clusters
+     *  @param  modifiedClusters the clusters modified by the last round of merges
+     *  @param  associationMap the record of pairwise associations between previously tested clean clusters, to be updated
+     *  @param  testedClusters the clean clusters for which all associations are recorded, to be updated
+     *  @param  clusterMergeMap to receive the cluster merge map
+     */
+    void UpdateClusterMergeMap(const pandora::ClusterVector &clusterVector, const pandora::ClusterSet &modifiedClusters,
+        ClusterMergeMap &associationMap, pandora::ClusterSet &testedClusters, ClusterMergeMap &clusterMergeMap) const;
 };
 
 } // namespace lar_content
@@ -11,6 +11,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArHitWidthCacheHelper.h"
 #include "larpandoracontent/LArHelpers/LArPcaHelper.h"
 
 using namespace pandora;
@@ -27,12 +28,31 @@ HitWidthClusterMergingAlgorithm::HitWidthClusterMergingAlgorithm() :
     m_maxZMergeDistance(2.f),
     m_minMergeCosOpeningAngle(0.97f),
     m_minDirectionDeviationCosAngle(0.9f),
-    m_minClusterSparseness(0.3f)
+    m_minClusterSparseness(0.3f),
+    m_useSharedHitWidthCache(false)
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+HitWidthClusterMergingAlgorithm::~HitWidthClusterMergingAlgorithm()
+{
+    if (m_useSharedHitWidthCache)
+        LArHitWidthCacheHelper::Erase(this->GetPandora());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode HitWidthClusterMergingAlgorithm::Reset()
+{
+    if (m_useSharedHitWidthCache)
+        LArHitWidthCacheHelper::Reset(this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void HitWidthClusterMergingAlgorithm::GetListOfCleanClusters(const ClusterList *const pClusterList, ClusterVector &clusterVector) const
 {
     // clear map if already full i.e. from other view clustering
@@ -57,8 +77,17 @@ void HitWidthClusterMergingAlgorithm::GetListOfCleanClusters(const ClusterList *
         if (clusterSparseness < m_minClusterSparseness)
             continue;
 
-        m_clusterToParametersMap.insert(std::pair<const Cluster *, LArHitWidthHelper::ClusterParameters>(
-            pCluster, LArHitWidthHelper::ClusterParameters(pCluster, m_maxConstituentHitWidth, false, m_hitWidthScalingFactor)));
+        if (m_useSharedHitWidthCache)
+        {
+            const LArHitWidthHelper::ClusterParameters &clusterParameters(LArHitWidthCacheHelper::GetClusterParameters(
+                this->GetPandora(), pCluster, m_maxConstituentHitWidth, false, m_hitWidthScalingFactor));
+            m_clusterToParametersMap.insert(std::pair<const Cluster *, LArHitWidthHelper::ClusterParameters>(pCluster, clusterParameters));
+        }
+        else
+        {
+            m_clusterToParametersMap.insert(std::pair<const Cluster *, LArHitWidthHelper::ClusterParameters>(
+                pCluster, LArHitWidthHelper::ClusterParameters(pCluster, m_maxConstituentHitWidth, false, m_hitWidthScalingFactor)));
+        }
 
         clusterVector.push_back(pCluster);
     }
@@ -101,13 +130,26 @@ void HitWidthClusterMergingAlgorithm::PopulateClusterAssociationMap(const Cluste
 
 bool HitWidthClusterMergingAlgorithm::IsExtremalCluster(const bool isForward, const Cluster *const pCurrentCluster, const Cluster *const pTestCluster) const
 {
-    //ATTN - cannot use map since higherXExtrema may have changed during merging
-    const LArHitWidthHelper::ConstituentHitVector currentConstituentHitVector(
-        LArHitWidthHelper::GetConstituentHits(pCurrentCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
-    const LArHitWidthHelper::ConstituentHitVector testConstituentHitVector(
-        LArHitWidthHelper::GetConstituentHits(pTestCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
-    const CartesianVector currentHigherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(currentConstituentHitVector));
-    const CartesianVector testHigherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(testConstituentHitVector));
+    //ATTN - cannot use map since higherXExtrema may have changed during merging (the shared cache checks for modified clusters)
+    CartesianVector currentHigherXExtrema(0.f, 0.f, 0.f), testHigherXExtrema(0.f, 0.f, 0.f);
+
+    if (m_useSharedHitWidthCache)
+    {
+        currentHigherXExtrema = LArHitWidthCacheHelper::GetClusterParameters(
+            this->GetPandora(), pCurrentCluster, m_maxConstituentHitWidth, false, m_hitWidthScalingFactor).GetHigherXExtrema();
+        testHigherXExtrema = LArHitWidthCacheHelper::GetClusterParameters(
+            this->GetPandora(), pTestCluster, m_maxConstituentHitWidth, false, m_hitWidthScalingFactor).GetHigherXExtrema();
+    }
+    else
+    {
+        const LArHitWidthHelper::ConstituentHitVector currentConstituentHitVector(
+            LArHitWidthHelper::GetConstituentHits(pCurrentCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
+        const LArHitWidthHelper::ConstituentHitVector testConstituentHitVector(
+            LArHitWidthHelper::GetConstituentHits(pTestCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
+        currentHigherXExtrema = LArHitWidthHelper::GetExtremalCoordinatesHigherX(currentConstituentHitVector);
+        testHigherXExtrema = LArHitWidthHelper::GetExtremalCoordinatesHigherX(testConstituentHitVector);
+    }
+
     float currentMaxX(currentHigherXExtrema.GetX()), testMaxX(testHigherXExtrema.GetX());
 
     if (isForward)
@@ -470,6 +512,9 @@ StatusCode HitWidthClusterMergingAlgorithm::ReadSettings(const TiXmlHandle xmlHa
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MinClusterSparseness", m_minClusterSparseness));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "UseSharedHitWidthCache", m_useSharedHitWidthCache));
+
     return ClusterAssociationAlgorithm::ReadSettings(xmlHandle);
 }
 
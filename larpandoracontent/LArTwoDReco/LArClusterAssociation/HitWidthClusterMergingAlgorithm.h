@@ -28,7 +28,13 @@ public:
      */
     HitWidthClusterMergingAlgorithm();
 
+    /**
+     *  @brief  Destructor
+     */
+    ~HitWidthClusterMergingAlgorithm();
+
 private:
+    pandora::StatusCode Reset();
     void GetListOfCleanClusters(const pandora::ClusterList *const pClusterList, pandora::ClusterVector &clusterVector) const;
     void PopulateClusterAssociationMap(const pandora::ClusterVector &clusterVector, ClusterAssociationMap &clusterAssociationMap) const;
     bool IsExtremalCluster(const bool isForward, const pandora::Cluster *const pCurrentCluster, const pandora::Cluster *const pTestCluster) const;
@@ -137,6 +143,7 @@ private:
     float m_minMergeCosOpeningAngle; ///< The minimum cosine opening angle of the directions of associated clusters
     float m_minDirectionDeviationCosAngle; ///< The minimum cosine opening angle of the direction of and associated cluster before and after merge
     float m_minClusterSparseness;          ///< The threshold sparseness of a cluster to be considered in the merging process
+    bool m_useSharedHitWidthCache;         ///< Whether to obtain cluster constituent hits via the event-scoped shared cache
 
     // ATTN Dangling pointers emerge during cluster merging, here explicitly not dereferenced
     mutable LArHitWidthHelper::ClusterToParametersMap m_clusterToParametersMap; ///< The map [cluster -> cluster parameters]
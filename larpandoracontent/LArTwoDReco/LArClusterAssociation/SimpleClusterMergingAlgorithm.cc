@@ -69,6 +69,20 @@ void SimpleClusterMergingAlgorithm::PopulateClusterMergeMap(const ClusterVector
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool SimpleClusterMergingAlgorithm::SupportsIncrementalMergeMap() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool SimpleClusterMergingAlgorithm::IsPairwiseAssociated(const Cluster *const pCluster1, const Cluster *const pCluster2) const
+{
+    return this->IsAssociated(pCluster1, pCluster2);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool SimpleClusterMergingAlgorithm::IsAssociated(const Cluster *const pClusterI, const Cluster *const pClusterJ) const
 {
     if (LArClusterHelper::GetClosestDistance(pClusterI, pClusterJ) > m_maxClusterSeparation)
@@ -0,0 +1,183 @@
+/**
+ *  @file   larpandoracontent/LArUtility/CaloHitGrid.cc
+ *
+ *  @brief  Implementation of the calo hit grid class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArUtility/CaloHitGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+CaloHitGrid::CaloHitGrid() :
+    m_cellSize(1.f),
+    m_maxHitWidth(0.f),
+    m_nHits(0),
+    m_nInsertions(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CaloHitGrid::CaloHitGrid(const float cellSize) :
+    CaloHitGrid()
+{
+    this->SetCellSize(cellSize);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitGrid::SetCellSize(const float cellSize)
+{
+    if (!this->IsEmpty())
+        throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
+
+    // ATTN: Any positive cell size gives the same search results, the choice only affects the number of cells visited
+    m_cellSize = (cellSize > std::numeric_limits<float>::epsilon()) ? cellSize : 1.f;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitGrid::Insert(const CaloHit *const pCaloHit)
+{
+    const CartesianVector &position(pCaloHit->GetPositionVector());
+    m_cellToHitEntriesMap[GetCellKey(this->GetCellIndex(position.GetX()), this->GetCellIndex(position.GetZ()))].emplace_back(
+        m_nInsertions++, pCaloHit);
+    m_maxHitWidth = std::max(m_maxHitWidth, pCaloHit->GetCellSize1());
+    ++m_nHits;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitGrid::Remove(const CaloHit *const pCaloHit)
+{
+    const CartesianVector &position(pCaloHit->GetPositionVector());
+    const CellToHitEntriesMap::iterator cellIter(
+        m_cellToHitEntriesMap.find(GetCellKey(this->GetCellIndex(position.GetX()), this->GetCellIndex(position.GetZ()))));
+
+    if (cellIter == m_cellToHitEntriesMap.end())
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    HitEntryVector &cellHitEntries(cellIter->second);
+    const HitEntryVector::iterator entryIter(std::find_if(
+        cellHitEntries.begin(), cellHitEntries.end(), [&](const HitEntry &hitEntry) { return (hitEntry.second == pCaloHit); }));
+
+    if (entryIter == cellHitEntries.end())
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    *entryIter = cellHitEntries.back();
+    cellHitEntries.pop_back();
+    --m_nHits;
+
+    if (cellHitEntries.empty())
+        m_cellToHitEntriesMap.erase(cellIter);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitGrid::Search(const KDTreeBox &searchRegion, CaloHitVector &foundHits) const
+{
+    const float minXIndex(std::floor(searchRegion.dimmin[0] / m_cellSize)), maxXIndex(std::floor(searchRegion.dimmax[0] / m_cellSize));
+    const float minZIndex(std::floor(searchRegion.dimmin[1] / m_cellSize)), maxZIndex(std::floor(searchRegion.dimmax[1] / m_cellSize));
+    const float nCells((maxXIndex - minXIndex + 1.f) * (maxZIndex - minZIndex + 1.f));
+    const float maxAbsIndex(std::max({std::fabs(minXIndex), std::fabs(maxXIndex), std::fabs(minZIndex), std::fabs(maxZIndex)}));
+    const bool isRepresentable(maxAbsIndex < static_cast<float>(std::numeric_limits<int>::max() / 2));
+
+    HitEntryVector foundHitEntries;
+
+    // ATTN If the search region spans more cells than are occupied, it is quicker to visit the occupied cells
+    if (!isRepresentable || !(nCells <= static_cast<float>(m_cellToHitEntriesMap.size())))
+    {
+        for (const CellToHitEntriesMap::value_type &mapEntry : m_cellToHitEntriesMap)
+            CaloHitGrid::SelectHitEntries(mapEntry.second, searchRegion, foundHitEntries);
+    }
+    else
+    {
+        for (int xIndex = static_cast<int>(minXIndex); xIndex <= static_cast<int>(maxXIndex); ++xIndex)
+        {
+            for (int zIndex = static_cast<int>(minZIndex); zIndex <= static_cast<int>(maxZIndex); ++zIndex)
+            {
+                const CellToHitEntriesMap::const_iterator cellIter(m_cellToHitEntriesMap.find(GetCellKey(xIndex, zIndex)));
+
+                if (cellIter != m_cellToHitEntriesMap.end())
+                    CaloHitGrid::SelectHitEntries(cellIter->second, searchRegion, foundHitEntries);
+            }
+        }
+    }
+
+    CaloHitGrid::FillCaloHitVector(foundHitEntries, foundHits);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitGrid::GetAllHits(CaloHitVector &caloHitVector) const
+{
+    HitEntryVector hitEntries;
+    hitEntries.reserve(m_nHits);
+
+    for (const CellToHitEntriesMap::value_type &mapEntry : m_cellToHitEntriesMap)
+        hitEntries.insert(hitEntries.end(), mapEntry.second.begin(), mapEntry.second.end());
+
+    CaloHitGrid::FillCaloHitVector(hitEntries, caloHitVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitGrid::Clear()
+{
+    m_cellToHitEntriesMap.clear();
+    m_maxHitWidth = 0.f;
+    m_nHits = 0;
+    m_nInsertions = 0;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int CaloHitGrid::GetCellIndex(const float coordinate) const
+{
+    return static_cast<int>(std::floor(coordinate / m_cellSize));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::uint64_t CaloHitGrid::GetCellKey(const int xIndex, const int zIndex)
+{
+    return ((static_cast<std::uint64_t>(static_cast<std::uint32_t>(xIndex)) << 32) | static_cast<std::uint32_t>(zIndex));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitGrid::SelectHitEntries(const HitEntryVector &hitEntries, const KDTreeBox &searchRegion, HitEntryVector &foundHitEntries)
+{
+    for (const HitEntry &hitEntry : hitEntries)
+    {
+        const CartesianVector &position(hitEntry.second->GetPositionVector());
+        const float x(position.GetX()), z(position.GetZ());
+
+        if ((x >= searchRegion.dimmin[0]) && (x <= searchRegion.dimmax[0]) && (z >= searchRegion.dimmin[1]) && (z <= searchRegion.dimmax[1]))
+            foundHitEntries.push_back(hitEntry);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitGrid::FillCaloHitVector(HitEntryVector &hitEntries, CaloHitVector &caloHitVector)
+{
+    std::sort(hitEntries.begin(), hitEntries.end(), [](const HitEntry &lhs, const HitEntry &rhs) { return (lhs.first < rhs.first); });
+    caloHitVector.reserve(caloHitVector.size() + hitEntries.size());
+
+    for (const HitEntry &hitEntry : hitEntries)
+        caloHitVector.push_back(hitEntry.second);
+}
+
+} // namespace lar_content
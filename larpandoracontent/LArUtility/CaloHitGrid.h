@@ -0,0 +1,163 @@
+/**
+ *  @file   larpandoracontent/LArUtility/CaloHitGrid.h
+ *
+ *  @brief  Header file for the calo hit grid class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_CALO_HIT_GRID_H
+#define LAR_CALO_HIT_GRID_H 1
+
+#include "Objects/CaloHit.h"
+
+#include "larpandoracontent/LArUtility/KDTreeLinkerToolsT.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  CaloHitGrid class, a dynamic spatial index of two dimensional hits, binned in x and z. Hits can be inserted and removed
+ *          individually, and searches return the hits inside a box in the order in which they were inserted, so results do not depend
+ *          on the cell size
+ */
+class CaloHitGrid
+{
+public:
+    /**
+     *  @brief  Default constructor, with unit cell size
+     */
+    CaloHitGrid();
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  cellSize the size of the grid cells, in each dimension (a non-positive size selects unit cell size)
+     */
+    CaloHitGrid(const float cellSize);
+
+    /**
+     *  @brief  Set the size of the grid cells, in each dimension. Only allowed when the grid is empty
+     *
+     *  @param  cellSize the cell size (a non-positive size selects unit cell size)
+     */
+    void SetCellSize(const float cellSize);
+
+    /**
+     *  @brief  Whether the grid is empty
+     *
+     *  @return boolean
+     */
+    bool IsEmpty() const;
+
+    /**
+     *  @brief  Insert a hit into the grid
+     *
+     *  @param  pCaloHit the address of the hit
+     */
+    void Insert(const pandora::CaloHit *const pCaloHit);
+
+    /**
+     *  @brief  Remove a hit from the grid
+     *
+     *  @param  pCaloHit the address of the hit
+     */
+    void Remove(const pandora::CaloHit *const pCaloHit);
+
+    /**
+     *  @brief  Find the hits lying inside a search region, with the same (inclusive) boundaries as the KD tree box search. The hits are
+     *          appended in the order in which they were inserted
+     *
+     *  @param  searchRegion the search region
+     *  @param  foundHits to receive the hits inside the search region
+     */
+    void Search(const KDTreeBox &searchRegion, pandora::CaloHitVector &foundHits) const;
+
+    /**
+     *  @brief  Get all hits in the grid, appended in the order in which they were inserted
+     *
+     *  @param  caloHitVector to receive the hits
+     */
+    void GetAllHits(pandora::CaloHitVector &caloHitVector) const;
+
+    /**
+     *  @brief  Get the largest width of any hit inserted since the grid was last cleared
+     *
+     *  @return the largest hit width
+     */
+    float GetMaxHitWidth() const;
+
+    /**
+     *  @brief  Remove all hits from the grid
+     */
+    void Clear();
+
+private:
+    typedef std::pair<unsigned int, const pandora::CaloHit *> HitEntry; ///< The insertion index and address of a hit
+    typedef std::vector<HitEntry> HitEntryVector;
+    typedef std::unordered_map<std::uint64_t, HitEntryVector> CellToHitEntriesMap;
+
+    /**
+     *  @brief  Get the index of the cell containing a coordinate
+     *
+     *  @param  coordinate the x or z coordinate
+     *
+     *  @return the cell index
+     */
+    int GetCellIndex(const float coordinate) const;
+
+    /**
+     *  @brief  Get the key identifying a cell
+     *
+     *  @param  xIndex the x cell index
+     *  @param  zIndex the z cell index
+     *
+     *  @return the cell key
+     */
+    static std::uint64_t GetCellKey(const int xIndex, const int zIndex);
+
+    /**
+     *  @brief  Append the hits inside a search region, from a vector of hit entries, to a list of found hit entries
+     *
+     *  @param  hitEntries the hit entries
+     *  @param  searchRegion the search region
+     *  @param  foundHitEntries to receive the hit entries inside the search region
+     */
+    static void SelectHitEntries(const HitEntryVector &hitEntries, const KDTreeBox &searchRegion, HitEntryVector &foundHitEntries);
+
+    /**
+     *  @brief  Sort hit entries into insertion order and append the hits to a vector
+     *
+     *  @param  hitEntries the hit entries
+     *  @param  caloHitVector to receive the hits
+     */
+    static void FillCaloHitVector(HitEntryVector &hitEntries, pandora::CaloHitVector &caloHitVector);
+
+    float m_cellSize;                          ///< The size of the grid cells, in each dimension
+    float m_maxHitWidth;                       ///< The largest width of any hit inserted since the grid was last cleared
+    unsigned int m_nHits;                      ///< The number of hits in the grid
+    unsigned int m_nInsertions;                ///< The number of insertions since the grid was last cleared
+    CellToHitEntriesMap m_cellToHitEntriesMap; ///< The map from cell key to the entries for the hits in the cell
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool CaloHitGrid::IsEmpty() const
+{
+    return (0 == m_nHits);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float CaloHitGrid::GetMaxHitWidth() const
+{
+    return m_maxHitWidth;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_CALO_HIT_GRID_H
@@ -10,28 +10,33 @@
 
 #include "KDTreeLinkerToolsT.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
 #include <vector>
 
 namespace lar_content
 {
 
 /**
- *  @brief  Class that implements the KDTree partition of 2D space and a closest point search algorithm
+ *  @brief  Class that implements the KDTree partition of 2D space and a closest point search algorithm. The tree is held in flat arrays:
+ *          nodes are stored in depth-first order (the left child of a node immediately follows it) and the elements are stored in the
+ *          order of the tree leaves, so that every subtree covers a contiguous range of elements. Storage is reused between rebuilds.
  */
 template <typename DATA, unsigned DIM = 2>
 class KDTreeLinkerAlgo
 {
 public:
+    typedef KDTreeNodeInfoT<DATA, DIM> NodeInfo;
+    typedef std::vector<NodeInfo> NodeInfoVector;
+
     /**
      *  @brief  Default constructor
      */
     KDTreeLinkerAlgo();
 
-    /**
-     *  @brief  Destructor calls clear
-     */
-    ~KDTreeLinkerAlgo();
-
     /**
      *  @brief  Build the KD tree from the "eltList" in the space define by "region"
      *
@@ -47,7 +52,7 @@ public:
      *  @param  searchBox
      *  @param  resRecHitList
      */
-    void search(const KDTreeBoxT<DIM> &searchBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList);
+    void search(const KDTreeBoxT<DIM> &searchBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList) const;
 
     /**
      *  @brief  findNearestNeighbour
@@ -56,61 +61,92 @@ public:
      *  @param  result
      *  @param  distance
      */
-    void findNearestNeighbour(const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance);
+    void findNearestNeighbour(const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance) const;
+
+    /**
+     *  @brief  Find the k points closest to a given point, ordered by increasing distance (ties resolved by position in the tree)
+     *
+     *  @param  point the target point
+     *  @param  k the number of neighbours to find
+     *  @param  result to receive the (at most k) closest points
+     */
+    void findKNearestNeighbours(const KDTreeNodeInfoT<DATA, DIM> &point, const unsigned int k, std::vector<KDTreeNodeInfoT<DATA, DIM>> &result) const;
+
+    /**
+     *  @brief  Count the points within a given distance of a given point
+     *
+     *  @param  point the target point
+     *  @param  radius the search radius
+     *
+     *  @return the number of points with distance less than or equal to the search radius
+     */
+    unsigned int countInRadius(const KDTreeNodeInfoT<DATA, DIM> &point, const float radius) const;
 
     /**
      *  @brief  Whether the tree is empty
      *
      *  @return boolean
      */
-    bool empty();
+    bool empty() const;
 
     /**
      *  @brief  Return the number of nodes + leaves in the tree (nElements should be (size() +1) / 2)
      *
      *  @return the number of nodes + leaves in the tree
      */
-    int size();
+    int size() const;
 
     /**
-     *  @brief  Clear all allocated structures
+     *  @brief  Clear the tree, retaining allocated storage for subsequent rebuilds
      */
     void clear();
 
 private:
     /**
-     *  @brief  Get the next node from the node pool
-     *
-     *  @return the next node from the node pool
+     *  @brief  Flat KDTree node, identifying its children by index
      */
-    KDTreeNodeT<DATA, DIM> *getNextNode();
+    class FlatNode
+    {
+    public:
+        /**
+         *  @brief  Whether the node is a leaf
+         *
+         *  @return boolean
+         */
+        bool isLeaf() const;
+
+        KDTreeBoxT<DIM> region; ///< Region bounding box
+        int low;                ///< The index of the first element in the node region
+        int high;               ///< The index after the last element in the node region
+        int right;              ///< The index of the right son (the left son immediately follows the node), or -1 for a leaf
+    };
+
+    // ATTN Median splitting bounds the tree depth by log2 of the number of elements, and traversal stacks hold at most depth + 1 entries
+    static const unsigned int MAX_STACK_SIZE = 128;
+
+    typedef std::vector<FlatNode> FlatNodeVector;
+    typedef std::pair<float, int> DistanceIndexPair;
 
     /**
      *  @brief  Fast median search with Wirth algorithm in eltList between low and high indexes.
      *
+     *  @param  eltList
      *  @param  low
      *  @param  high
      *  @param  treeDepth
      */
-    int medianSearch(int low, int high, int treeDepth);
+    int medianSearch(std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, int low, int high, int treeDepth) const;
 
     /**
      *  @brief  Recursive kdtree builder. Is called by build()
      *
+     *  @param  eltList
      *  @param  low
      *  @param  high
      *  @param  depth
      *  @param  region
      */
-    KDTreeNodeT<DATA, DIM> *recBuild(int low, int high, int depth, const KDTreeBoxT<DIM> &region);
-
-    /**
-     *  @brief  Recursive kdtree search. Is called by search()
-     *
-     *  @param  current
-     *  @param  trackBox
-     */
-    void recSearch(const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox);
+    void recBuild(std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, int low, int high, int depth, const KDTreeBoxT<DIM> &region);
 
     /**
      *  @brief  Recursive nearest neighbour search. Is called by findNearestNeighbour()
@@ -121,15 +157,28 @@ private:
      *  @param  best_match
      *  @param  best_dist
      */
-    void recNearestNeighbour(unsigned depth, const KDTreeNodeT<DATA, DIM> *current, const KDTreeNodeInfoT<DATA, DIM> &point,
-        const KDTreeNodeT<DATA, DIM> *&best_match, float &best_dist);
+    void recNearestNeighbour(unsigned depth, const int current, const KDTreeNodeInfoT<DATA, DIM> &point, int &best_match, float &best_dist) const;
 
     /**
-     *  @brief  Add all elements of an subtree to the closest elements. Used during the recSearch().
+     *  @brief  Get the action required for a son node during a box search
      *
-     *  @param  current
+     *  @param  son the index of the son node
+     *  @param  trackBox the search box
+     *  @param  isFullyContained to receive whether the son region is fully contained in the search box
+     *
+     *  @return whether the son region intersects the search box
      */
-    void addSubtree(const KDTreeNodeT<DATA, DIM> *current);
+    bool checkSearchBox(const int son, const KDTreeBoxT<DIM> &trackBox, bool &isFullyContained) const;
+
+    /**
+     *  @brief  Squared distance between a point and the closest point of a node region
+     *
+     *  @param  point
+     *  @param  node
+     *
+     *  @return the squared distance
+     */
+    float regionDist2(const KDTreeNodeInfoT<DATA, DIM> &point, const int node) const;
 
     /**
      *  @brief  dist2
@@ -141,40 +190,26 @@ private:
      */
     float dist2(const KDTreeNodeInfoT<DATA, DIM> &a, const KDTreeNodeInfoT<DATA, DIM> &b) const;
 
-    /**
-     *  @brief  Frees the KDTree.
-     */
-    void clearTree();
-
-    KDTreeNodeT<DATA, DIM> *root_;     ///< The KDTree root
-    KDTreeNodeT<DATA, DIM> *nodePool_; ///< Node pool allows us to do just 1 call to new for each tree building
-    int nodePoolSize_;                 ///< The node pool size
-    int nodePoolPos_;                  ///< The node pool position
-
-    std::vector<KDTreeNodeInfoT<DATA, DIM>> *closestNeighbour; ///< The closest neighbour
-    std::vector<KDTreeNodeInfoT<DATA, DIM>> *initialEltList;   ///< The initial element list
+    FlatNodeVector nodes_;     ///< The tree nodes, in depth-first order, with the root at index zero
+    NodeInfoVector nodeInfos_; ///< The data for each tree node (the median element for a node, the element itself for a leaf)
+    NodeInfoVector elements_;  ///< The elements, in tree leaf order
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline KDTreeLinkerAlgo<DATA, DIM>::KDTreeLinkerAlgo() :
-    root_(nullptr),
-    nodePool_(nullptr),
-    nodePoolSize_(-1),
-    nodePoolPos_(-1),
-    closestNeighbour(nullptr),
-    initialEltList(nullptr)
+inline bool KDTreeLinkerAlgo<DATA, DIM>::FlatNode::isLeaf() const
 {
+    return (right < 0);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline KDTreeLinkerAlgo<DATA, DIM>::~KDTreeLinkerAlgo()
+inline KDTreeLinkerAlgo<DATA, DIM>::KDTreeLinkerAlgo()
 {
-    this->clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -182,28 +217,26 @@ inline KDTreeLinkerAlgo<DATA, DIM>::~KDTreeLinkerAlgo()
 template <typename DATA, unsigned DIM>
 inline void KDTreeLinkerAlgo<DATA, DIM>::build(std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, const KDTreeBoxT<DIM> &region)
 {
+    this->clear();
+
     if (eltList.size())
     {
-        initialEltList = &eltList;
-        const size_t mysize = initialEltList->size();
-
-        nodePoolSize_ = mysize * 2 - 1;
-        nodePool_ = new KDTreeNodeT<DATA, DIM>[nodePoolSize_];
+        const size_t mysize = eltList.size();
+        nodes_.reserve(mysize * 2 - 1);
+        nodeInfos_.resize(mysize * 2 - 1);
 
         // Here we build the KDTree
-        root_ = this->recBuild(0, mysize, 0, region);
-        initialEltList = nullptr;
+        this->recBuild(eltList, 0, mysize, 0, region);
+        elements_.assign(eltList.begin(), eltList.end());
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(int low, int high, int treeDepth)
+inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, int low, int high, int treeDepth) const
 {
-    // We should have at least 1 element to calculate the median...
-    //assert(low < high);
-
+    // ATTN The element permutation produced here defines the order of search results, so is retained in preference to std::nth_element
     const int nbrElts = high - low;
     int median = nbrElts / 2 - (1 - 1 * (nbrElts & 1));
     median += low;
@@ -213,7 +246,7 @@ inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(int low, int high, int tree
 
     while (l < m)
     {
-        KDTreeNodeInfoT<DATA, DIM> elt = (*initialEltList)[median];
+        KDTreeNodeInfoT<DATA, DIM> elt = eltList[median];
         int i = l;
         int j = m;
 
@@ -221,14 +254,14 @@ inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(int low, int high, int tree
         {
             // The even depth is associated to dim1 dimension, the odd one to dim2 dimension
             const unsigned thedim = treeDepth % DIM;
-            while ((*initialEltList)[i].dims[thedim] < elt.dims[thedim])
+            while (eltList[i].dims[thedim] < elt.dims[thedim])
                 ++i;
-            while ((*initialEltList)[j].dims[thedim] > elt.dims[thedim])
+            while (eltList[j].dims[thedim] > elt.dims[thedim])
                 --j;
 
             if (i <= j)
             {
-                std::swap((*initialEltList)[i], (*initialEltList)[j]);
+                std::swap(eltList[i], eltList[j]);
                 i++;
                 j--;
             }
@@ -246,93 +279,86 @@ inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(int low, int high, int tree
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::search(const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits)
+inline void KDTreeLinkerAlgo<DATA, DIM>::search(const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
 {
-    if (root_)
-    {
-        closestNeighbour = &recHits;
-        this->recSearch(root_, trackBox);
-        closestNeighbour = nullptr;
-    }
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
+    if (nodes_.empty())
+        return;
 
-template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox)
-{
-    // By construction, current can't be null
-    //assert(current != 0);
-    // By Construction, a node can't have just 1 son.
-    //assert (!(((current->left == 0) && (current->right != 0)) || ((current->left != 0) && (current->right == 0))));
+    // Depth-first traversal, left son first, with each stack entry flagging whether its region is fully contained in the search box
+    std::array<int, MAX_STACK_SIZE> nodeStack;
+    std::array<bool, MAX_STACK_SIZE> isFullyContainedStack;
+    unsigned int stackSize(0);
+    nodeStack[stackSize] = 0;
+    isFullyContainedStack[stackSize++] = false;
 
-    if ((current->left == nullptr) && (current->right == nullptr))
+    while (stackSize > 0)
     {
-        // Leaf case
-        // If point inside the rectangle/area
-        bool isInside = true;
+        --stackSize;
+        const int currentIndex(nodeStack[stackSize]);
+        const FlatNode &current(nodes_[currentIndex]);
 
-        for (unsigned i = 0; i < DIM; ++i)
+        if (isFullyContainedStack[stackSize])
         {
-            const auto thedim = current->info.dims[i];
-            isInside = isInside && thedim >= trackBox.dimmin[i] && thedim <= trackBox.dimmax[i];
+            recHits.insert(recHits.end(), elements_.begin() + current.low, elements_.begin() + current.high);
         }
-
-        if (isInside)
-            closestNeighbour->push_back(current->info);
-    }
-    else
-    {
-        // Node case
-        // If region( v->left ) is fully contained in the rectangle
-        bool isFullyContained = true;
-        bool hasIntersection = true;
-
-        for (unsigned i = 0; i < DIM; ++i)
+        else if (current.isLeaf())
         {
-            const auto regionmin = current->left->region.dimmin[i];
-            const auto regionmax = current->left->region.dimmax[i];
-            isFullyContained = isFullyContained && (regionmin >= trackBox.dimmin[i] && regionmax <= trackBox.dimmax[i]);
-            hasIntersection = hasIntersection && (regionmin < trackBox.dimmax[i] && regionmax > trackBox.dimmin[i]);
-        }
+            // If point inside the rectangle/area
+            bool isInside = true;
 
-        if (isFullyContained)
-        {
-            this->addSubtree(current->left);
+            for (unsigned i = 0; i < DIM; ++i)
+            {
+                const auto thedim = elements_[current.low].dims[i];
+                isInside = isInside && thedim >= trackBox.dimmin[i] && thedim <= trackBox.dimmax[i];
+            }
+
+            if (isInside)
+                recHits.push_back(elements_[current.low]);
         }
-        else if (hasIntersection)
+        else
         {
-            this->recSearch(current->left, trackBox);
-        }
+            bool isFullyContained(false);
 
-        //if region( v->right ) is fully contained in the rectangle
-        isFullyContained = true;
-        hasIntersection = true;
+            if (this->checkSearchBox(current.right, trackBox, isFullyContained))
+            {
+                nodeStack[stackSize] = current.right;
+                isFullyContainedStack[stackSize++] = isFullyContained;
+            }
 
-        for (unsigned i = 0; i < DIM; ++i)
-        {
-            const auto regionmin = current->right->region.dimmin[i];
-            const auto regionmax = current->right->region.dimmax[i];
-            isFullyContained = isFullyContained && (regionmin >= trackBox.dimmin[i] && regionmax <= trackBox.dimmax[i]);
-            hasIntersection = hasIntersection && (regionmin < trackBox.dimmax[i] && regionmax > trackBox.dimmin[i]);
+            if (this->checkSearchBox(currentIndex + 1, trackBox, isFullyContained))
+            {
+                nodeStack[stackSize] = currentIndex + 1;
+                isFullyContainedStack[stackSize++] = isFullyContained;
+            }
         }
+    }
+}
 
-        if (isFullyContained)
-        {
-            this->addSubtree(current->right);
-        }
-        else if (hasIntersection)
-        {
-            this->recSearch(current->right, trackBox);
-        }
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline bool KDTreeLinkerAlgo<DATA, DIM>::checkSearchBox(const int son, const KDTreeBoxT<DIM> &trackBox, bool &isFullyContained) const
+{
+    const KDTreeBoxT<DIM> &region(nodes_[son].region);
+    bool hasIntersection = true;
+    isFullyContained = true;
+
+    for (unsigned i = 0; i < DIM; ++i)
+    {
+        const auto regionmin = region.dimmin[i];
+        const auto regionmax = region.dimmax[i];
+        isFullyContained = isFullyContained && (regionmin >= trackBox.dimmin[i] && regionmax <= trackBox.dimmax[i]);
+        hasIntersection = hasIntersection && (regionmin < trackBox.dimmax[i] && regionmax > trackBox.dimmin[i]);
     }
+
+    return (isFullyContained || hasIntersection);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
 inline void KDTreeLinkerAlgo<DATA, DIM>::findNearestNeighbour(
-    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance)
+    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance) const
 {
     if (nullptr != result || distance != std::numeric_limits<float>::max())
     {
@@ -340,14 +366,14 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::findNearestNeighbour(
         distance = std::numeric_limits<float>::max();
     }
 
-    if (root_)
+    if (!nodes_.empty())
     {
-        const KDTreeNodeT<DATA, DIM> *best_match = nullptr;
-        this->recNearestNeighbour(0, root_, point, best_match, distance);
+        int best_match = -1;
+        this->recNearestNeighbour(0, 0, point, best_match, distance);
 
         if (distance != std::numeric_limits<float>::max())
         {
-            result = &(best_match->info);
+            result = &(nodeInfos_[best_match]);
             distance = std::sqrt(distance);
         }
     }
@@ -356,32 +382,34 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::findNearestNeighbour(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::recNearestNeighbour(unsigned int depth, const KDTreeNodeT<DATA, DIM> *current,
-    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeT<DATA, DIM> *&best_match, float &best_dist)
+inline void KDTreeLinkerAlgo<DATA, DIM>::recNearestNeighbour(
+    unsigned int depth, const int current, const KDTreeNodeInfoT<DATA, DIM> &point, int &best_match, float &best_dist) const
 {
     const unsigned int current_dim = depth % DIM;
+    const FlatNode &node(nodes_[current]);
 
-    if (current->left == nullptr && current->right == nullptr)
+    if (node.isLeaf())
     {
         best_match = current;
-        best_dist = this->dist2(point, best_match->info);
+        best_dist = this->dist2(point, nodeInfos_[current]);
         return;
     }
     else
     {
-        const float dist_to_axis = point.dims[current_dim] - current->info.dims[current_dim];
+        const float dist_to_axis = point.dims[current_dim] - nodeInfos_[current].dims[current_dim];
+        const int left(current + 1), right(node.right);
 
         if (dist_to_axis < 0.f)
         {
-            this->recNearestNeighbour(depth + 1, current->left, point, best_match, best_dist);
+            this->recNearestNeighbour(depth + 1, left, point, best_match, best_dist);
         }
         else
         {
-            this->recNearestNeighbour(depth + 1, current->right, point, best_match, best_dist);
+            this->recNearestNeighbour(depth + 1, right, point, best_match, best_dist);
         }
 
         // If we're here we're returned so best_dist is filled. Compare to this node and see if it's a better match. If it is, update result
-        const float dist_current = this->dist2(point, current->info);
+        const float dist_current = this->dist2(point, nodeInfos_[current]);
 
         if (dist_current < best_dist)
         {
@@ -393,16 +421,16 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recNearestNeighbour(unsigned int depth,
         if (best_dist > dist_to_axis * dist_to_axis)
         {
             // if it does we traverse the other side of the axis to check for a new best
-            const KDTreeNodeT<DATA, DIM> *check_best = best_match;
+            int check_best = best_match;
             float check_dist = best_dist;
 
             if (dist_to_axis < 0.f)
             {
-                this->recNearestNeighbour(depth + 1, current->right, point, check_best, check_dist);
+                this->recNearestNeighbour(depth + 1, right, point, check_best, check_dist);
             }
             else
             {
-                this->recNearestNeighbour(depth + 1, current->left, point, check_best, check_dist);
+                this->recNearestNeighbour(depth + 1, left, point, check_best, check_dist);
             }
 
             if (check_dist < best_dist)
@@ -418,34 +446,117 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recNearestNeighbour(unsigned int depth,
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::addSubtree(const KDTreeNodeT<DATA, DIM> *current)
+inline void KDTreeLinkerAlgo<DATA, DIM>::findKNearestNeighbours(
+    const KDTreeNodeInfoT<DATA, DIM> &point, const unsigned int k, std::vector<KDTreeNodeInfoT<DATA, DIM>> &result) const
 {
-    // By construction, current can't be null
-    //assert(current != 0);
+    result.clear();
+
+    if (nodes_.empty() || (0 == k))
+        return;
+
+    // Max-heap of the best candidates found so far, ordered by squared distance and then element index
+    std::vector<DistanceIndexPair> candidateHeap;
+    candidateHeap.reserve(k);
 
-    if ((current->left == nullptr) && (current->right == nullptr))
+    std::array<int, MAX_STACK_SIZE> nodeStack;
+    unsigned int stackSize(0);
+    nodeStack[stackSize++] = 0;
+
+    while (stackSize > 0)
     {
-        // Leaf case
-        closestNeighbour->push_back(current->info);
+        const int current(nodeStack[--stackSize]);
+
+        const bool isHeapFull(candidateHeap.size() == k);
+
+        if (isHeapFull && (this->regionDist2(point, current) > candidateHeap.front().first))
+            continue;
+
+        const FlatNode &node(nodes_[current]);
+
+        if (node.isLeaf())
+        {
+            const DistanceIndexPair candidate(this->dist2(point, elements_[node.low]), node.low);
+
+            if (!isHeapFull)
+            {
+                candidateHeap.push_back(candidate);
+                std::push_heap(candidateHeap.begin(), candidateHeap.end());
+            }
+            else if (candidate < candidateHeap.front())
+            {
+                std::pop_heap(candidateHeap.begin(), candidateHeap.end());
+                candidateHeap.back() = candidate;
+                std::push_heap(candidateHeap.begin(), candidateHeap.end());
+            }
+        }
+        else
+        {
+            // Visit the closer son first
+            const int left(current + 1), right(node.right);
+            const bool isLeftCloser(this->regionDist2(point, left) <= this->regionDist2(point, right));
+            nodeStack[stackSize++] = isLeftCloser ? right : left;
+            nodeStack[stackSize++] = isLeftCloser ? left : right;
+        }
     }
-    else
+
+    std::sort_heap(candidateHeap.begin(), candidateHeap.end());
+
+    for (const DistanceIndexPair &candidate : candidateHeap)
+        result.push_back(elements_[candidate.second]);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline unsigned int KDTreeLinkerAlgo<DATA, DIM>::countInRadius(const KDTreeNodeInfoT<DATA, DIM> &point, const float radius) const
+{
+    if (nodes_.empty() || (radius < 0.f))
+        return 0;
+
+    const float radius2(radius * radius);
+    unsigned int count(0);
+
+    std::array<int, MAX_STACK_SIZE> nodeStack;
+    unsigned int stackSize(0);
+    nodeStack[stackSize++] = 0;
+
+    while (stackSize > 0)
     {
-        // Node case
-        this->addSubtree(current->left);
-        this->addSubtree(current->right);
+        const int current(nodeStack[--stackSize]);
+
+        if (this->regionDist2(point, current) > radius2)
+            continue;
+
+        const FlatNode &node(nodes_[current]);
+
+        if (node.isLeaf())
+        {
+            if (this->dist2(point, elements_[node.low]) <= radius2)
+                ++count;
+        }
+        else
+        {
+            nodeStack[stackSize++] = node.right;
+            nodeStack[stackSize++] = current + 1;
+        }
     }
+
+    return count;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline float KDTreeLinkerAlgo<DATA, DIM>::dist2(const KDTreeNodeInfoT<DATA, DIM> &a, const KDTreeNodeInfoT<DATA, DIM> &b) const
+inline float KDTreeLinkerAlgo<DATA, DIM>::regionDist2(const KDTreeNodeInfoT<DATA, DIM> &point, const int node) const
 {
+    const KDTreeBoxT<DIM> &region(nodes_[node].region);
     double d = 0.;
 
     for (unsigned i = 0; i < DIM; ++i)
     {
-        const double diff = a.dims[i] - b.dims[i];
+        const double diff = (point.dims[i] < region.dimmin[i])   ? region.dimmin[i] - point.dims[i]
+                            : (point.dims[i] > region.dimmax[i]) ? point.dims[i] - region.dimmax[i]
+                                                                 : 0.;
         d += diff * diff;
     }
 
@@ -455,97 +566,89 @@ inline float KDTreeLinkerAlgo<DATA, DIM>::dist2(const KDTreeNodeInfoT<DATA, DIM>
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::clearTree()
+inline float KDTreeLinkerAlgo<DATA, DIM>::dist2(const KDTreeNodeInfoT<DATA, DIM> &a, const KDTreeNodeInfoT<DATA, DIM> &b) const
 {
-    delete[] nodePool_;
-    nodePool_ = nullptr;
-    root_ = nullptr;
-    nodePoolSize_ = -1;
-    nodePoolPos_ = -1;
-}
+    double d = 0.;
 
-//------------------------------------------------------------------------------------------------------------------------------------------
+    for (unsigned i = 0; i < DIM; ++i)
+    {
+        const double diff = a.dims[i] - b.dims[i];
+        d += diff * diff;
+    }
 
-template <typename DATA, unsigned DIM>
-inline bool KDTreeLinkerAlgo<DATA, DIM>::empty()
-{
-    return (nodePoolPos_ == -1);
+    return (float)d;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline int KDTreeLinkerAlgo<DATA, DIM>::size()
+inline bool KDTreeLinkerAlgo<DATA, DIM>::empty() const
 {
-    return (nodePoolPos_ + 1);
+    return nodes_.empty();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::clear()
+inline int KDTreeLinkerAlgo<DATA, DIM>::size() const
 {
-    if (root_)
-        this->clearTree();
+    return nodes_.size();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline KDTreeNodeT<DATA, DIM> *KDTreeLinkerAlgo<DATA, DIM>::getNextNode()
+inline void KDTreeLinkerAlgo<DATA, DIM>::clear()
 {
-    ++nodePoolPos_;
-
-    // The tree size is exactly 2 * nbrElts - 1 and this is the total allocated memory.
-    // If we have used more than that....there is a big problem.
-    //assert(nodePoolPos_ < nodePoolSize_);
-
-    return &(nodePool_[nodePoolPos_]);
+    nodes_.clear();
+    nodeInfos_.clear();
+    elements_.clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline KDTreeNodeT<DATA, DIM> *KDTreeLinkerAlgo<DATA, DIM>::recBuild(int low, int high, int depth, const KDTreeBoxT<DIM> &region)
+inline void KDTreeLinkerAlgo<DATA, DIM>::recBuild(
+    std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, int low, int high, int depth, const KDTreeBoxT<DIM> &region)
 {
     const int portionSize = high - low;
+    const int nodeIndex = nodes_.size();
 
-    // By construction, portionSize > 0 can't happen.
-    //assert(portionSize > 0);
+    nodes_.emplace_back();
+    nodes_[nodeIndex].region = region;
+    nodes_[nodeIndex].low = low;
+    nodes_[nodeIndex].high = high;
+    nodes_[nodeIndex].right = -1;
 
     if (portionSize == 1)
     {
         // Leaf case
-        KDTreeNodeT<DATA, DIM> *leaf = this->getNextNode();
-        leaf->setAttributs(region, (*initialEltList)[low]);
-        return leaf;
+        nodeInfos_[nodeIndex] = eltList[low];
     }
     else
     {
         // The even depth is associated to dim1 dimension, the odd one to dim2 dimension
-        int medianId = this->medianSearch(low, high, depth);
+        int medianId = this->medianSearch(eltList, low, high, depth);
 
-        // We create the node
-        KDTreeNodeT<DATA, DIM> *node = this->getNextNode();
-        node->setAttributs(region);
-        node->info = (*initialEltList)[medianId];
+        // ATTN Node info is taken at this point, before any further partitioning of the left son elements
+        nodeInfos_[nodeIndex] = eltList[medianId];
 
         // Here we split into 2 halfplanes the current plane
         KDTreeBoxT<DIM> leftRegion = region;
         KDTreeBoxT<DIM> rightRegion = region;
 
         const unsigned thedim = depth % DIM;
-        auto medianVal = (*initialEltList)[medianId].dims[thedim];
+        auto medianVal = eltList[medianId].dims[thedim];
         leftRegion.dimmax[thedim] = medianVal;
         rightRegion.dimmin[thedim] = medianVal;
 
         ++depth;
         ++medianId;
 
-        // We recursively build the son nodes
-        node->left = this->recBuild(low, medianId, depth, leftRegion);
-        node->right = this->recBuild(medianId, high, depth, rightRegion);
-        return node;
+        // We recursively build the son nodes, the left son immediately following this node and spanning 2 * nLeft - 1 nodes
+        this->recBuild(eltList, low, medianId, depth, leftRegion);
+        nodes_[nodeIndex].right = nodeIndex + 2 * (medianId - low);
+        this->recBuild(eltList, medianId, high, depth, rightRegion);
     }
 }
 
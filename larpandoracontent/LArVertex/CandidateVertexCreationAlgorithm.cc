@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArVertex/CandidateVertexCreationAlgorithm.h"
 
@@ -23,6 +24,7 @@ namespace lar_content
 CandidateVertexCreationAlgorithm::CandidateVertexCreationAlgorithm() :
     m_replaceCurrentVertexList(true),
     m_slidingFitWindow(20),
+    m_useSharedSlidingFitCache(false),
     m_minClusterCaloHits(5),
     m_minClusterLengthSquared(3.f * 3.f),
     m_chiSquaredCut(2.f),
@@ -43,6 +45,24 @@ CandidateVertexCreationAlgorithm::CandidateVertexCreationAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+CandidateVertexCreationAlgorithm::~CandidateVertexCreationAlgorithm()
+{
+    if (m_useSharedSlidingFitCache)
+        LArSlidingFitCacheHelper::Erase(this->GetPandora());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CandidateVertexCreationAlgorithm::Reset()
+{
+    if (m_useSharedSlidingFitCache)
+        LArSlidingFitCacheHelper::Reset(this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CandidateVertexCreationAlgorithm::Run()
 {
     try
@@ -426,6 +446,18 @@ void CandidateVertexCreationAlgorithm::AddInputVertices() const
 void CandidateVertexCreationAlgorithm::AddToSlidingFitCache(const Cluster *const pCluster)
 {
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+
+    if (m_useSharedSlidingFitCache)
+    {
+        const TwoDSlidingFitResult &slidingFitResult(
+            LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), pCluster, m_slidingFitWindow, slidingFitPitch));
+
+        if (!m_slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(pCluster, slidingFitResult)).second)
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+
+        return;
+    }
+
     const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitWindow, slidingFitPitch);
 
     if (!m_slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(pCluster, slidingFitResult)).second)
@@ -468,6 +500,9 @@ StatusCode CandidateVertexCreationAlgorithm::ReadSettings(const TiXmlHandle xmlH
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SlidingFitWindow", m_slidingFitWindow));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "UseSharedSlidingFitCache", m_useSharedSlidingFitCache));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MinClusterCaloHits", m_minClusterCaloHits));
 
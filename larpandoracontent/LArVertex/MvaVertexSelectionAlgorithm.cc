@@ -75,11 +75,8 @@ void MvaVertexSelectionAlgorithm<T>::GetVertexScoreList(const VertexVector &vert
     this->AddEventFeaturesToVector(eventFeatureInfo, eventFeatureList);
 
     VertexFeatureInfoMap vertexFeatureInfoMap;
-    for (const Vertex *const pVertex : vertexVector)
-    {
-        this->PopulateVertexFeatureInfoMap(
-            beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, pVertex, vertexFeatureInfoMap);
-    }
+    this->PopulateVertexFeatureInfoMap(
+        beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, vertexVector, vertexFeatureInfoMap);
 
     // Use a simple score to get the list of vertices representing good regions.
     VertexScoreList initialScoreList;
@@ -14,6 +14,7 @@
 #include "larpandoracontent/LArHelpers/LArInteractionTypeHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
 
 #include "larpandoracontent/LArVertex/EnergyDepositionAsymmetryFeatureTool.h"
 #include "larpandoracontent/LArVertex/EnergyKickFeatureTool.h"
@@ -38,6 +39,7 @@ TrainedVertexSelectionAlgorithm::TrainedVertexSelectionAlgorithm() :
     m_trainingSetMode(false),
     m_allowClassifyDuringTraining(false),
     m_mcVertexXCorrection(0.f),
+    m_nFeatureThreads(1),
     m_minClusterCaloHits(12),
     m_slidingFitWindow(100),
     m_minShowerSpineLength(15.f),
@@ -429,52 +431,36 @@ void TrainedVertexSelectionAlgorithm::PopulateVertexFeatureInfoMap(const BeamCon
     const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
     const Vertex *const pVertex, VertexFeatureInfoMap &vertexFeatureInfoMap) const
 {
-    float bestFastScore(-std::numeric_limits<float>::max()); // not actually used - artefact of toolizing RPhi score and still using performance trick
-
-    // ATTN - If beam mode is false GetBeamDeweightingScore will fail, so have a default value that we'll ignore when poplating the feature vector
-    double tempBeamDeweight{0.f};
-    if (this->IsBeamModeOn())
-        tempBeamDeweight = this->GetBeamDeweightingScore(beamConstants, pVertex);
-
-    const double beamDeweighting(tempBeamDeweight);
-
-    const double energyKick(LArMvaHelper::CalculateFeaturesOfType<EnergyKickFeatureTool>(m_featureToolVector, this, pVertex,
-        slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore)
-                                .at(0)
-                                .Get());
-
-    const double localAsymmetry(LArMvaHelper::CalculateFeaturesOfType<LocalAsymmetryFeatureTool>(m_featureToolVector, this, pVertex,
-        slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore)
-                                    .at(0)
-                                    .Get());
-
-    const double globalAsymmetry(LArMvaHelper::CalculateFeaturesOfType<GlobalAsymmetryFeatureTool>(m_featureToolVector, this, pVertex,
-        slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore)
-                                     .at(0)
-                                     .Get());
-
-    const double showerAsymmetry(LArMvaHelper::CalculateFeaturesOfType<ShowerAsymmetryFeatureTool>(m_featureToolVector, this, pVertex,
-        slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore)
-                                     .at(0)
-                                     .Get());
+    LArMvaHelper::MvaFeatureVector featureVector;
+    const VertexFeatureInfo vertexFeatureInfo(this->CalculateVertexFeatureInfo(
+        beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, pVertex, featureVector));
+    vertexFeatureInfoMap.emplace(pVertex, vertexFeatureInfo);
+}
 
-    //const double rPhiFeature(LArMvaHelper::CalculateFeaturesOfType<RPhiFeatureTool>(m_featureToolVector, this, pVertex,
-    //    slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore).at(0).Get());
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    double dEdxAsymmetry(0.f), vertexEnergy(0.f);
+void TrainedVertexSelectionAlgorithm::PopulateVertexFeatureInfoMap(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
+    const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+    const VertexVector &vertexVector, VertexFeatureInfoMap &vertexFeatureInfoMap) const
+{
+    const unsigned int nVertices(vertexVector.size());
+    // ATTN: Feature tools print algorithm info as they run, so stay on a single thread when it is displayed to keep output readable
+    const bool displayInfo(PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo());
+    const unsigned int nThreads(displayInfo ? 1 : LArThreadingHelper::GetNThreads(m_nFeatureThreads, nVertices));
 
-    if (!m_legacyVariables)
-    {
-        dEdxAsymmetry = LArMvaHelper::CalculateFeaturesOfType<EnergyDepositionAsymmetryFeatureTool>(m_featureToolVector, this, pVertex,
-            slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore)
-                            .at(0)
-                            .Get();
+    // Each vertex is evaluated into its own slot, with scratch feature vectors per thread, then the map is filled in vertex order
+    std::vector<VertexFeatureInfo> vertexFeatureInfoVector(nVertices, VertexFeatureInfo(0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f));
+    std::vector<LArMvaHelper::MvaFeatureVector> featureVectors(nThreads);
 
-        vertexEnergy = this->GetVertexEnergy(pVertex, kdTreeMap);
-    }
+    LArThreadingHelper::RunTasks(nThreads, nVertices,
+        [&](const unsigned int threadIndex, const unsigned int vertexIndex)
+        {
+            vertexFeatureInfoVector.at(vertexIndex) = this->CalculateVertexFeatureInfo(beamConstants, clusterListMap, slidingFitDataListMap,
+                showerClusterListMap, kdTreeMap, vertexVector.at(vertexIndex), featureVectors.at(threadIndex));
+        });
 
-    VertexFeatureInfo vertexFeatureInfo(beamDeweighting, 0.f, energyKick, localAsymmetry, globalAsymmetry, showerAsymmetry, dEdxAsymmetry, vertexEnergy);
-    vertexFeatureInfoMap.emplace(pVertex, vertexFeatureInfo);
+    for (unsigned int vertexIndex = 0; vertexIndex < nVertices; ++vertexIndex)
+        vertexFeatureInfoMap.emplace(vertexVector.at(vertexIndex), vertexFeatureInfoVector.at(vertexIndex));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -853,6 +839,69 @@ void TrainedVertexSelectionAlgorithm::PopulateFinalVertexScoreList(const VertexF
     }
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TrainedVertexSelectionAlgorithm::VertexFeatureInfo TrainedVertexSelectionAlgorithm::CalculateVertexFeatureInfo(
+    const BeamConstants &beamConstants, const ClusterListMap &clusterListMap, const SlidingFitDataListMap &slidingFitDataListMap,
+    const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap, const Vertex *const pVertex,
+    LArMvaHelper::MvaFeatureVector &featureVector) const
+{
+    float bestFastScore(-std::numeric_limits<float>::max()); // not actually used - artefact of toolizing RPhi score and still using performance trick
+
+    // ATTN - If beam mode is false GetBeamDeweightingScore will fail, so have a default value that we'll ignore when poplating the feature vector
+    double tempBeamDeweight{0.f};
+    if (this->IsBeamModeOn())
+        tempBeamDeweight = this->GetBeamDeweightingScore(beamConstants, pVertex);
+
+    const double beamDeweighting(tempBeamDeweight);
+
+    const double energyKick(this->GetLeadingFeature(m_energyKickFeatureTools, pVertex, slidingFitDataListMap, clusterListMap, kdTreeMap,
+        showerClusterListMap, beamDeweighting, bestFastScore, featureVector));
+
+    const double localAsymmetry(this->GetLeadingFeature(m_localAsymmetryFeatureTools, pVertex, slidingFitDataListMap, clusterListMap,
+        kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore, featureVector));
+
+    const double globalAsymmetry(this->GetLeadingFeature(m_globalAsymmetryFeatureTools, pVertex, slidingFitDataListMap, clusterListMap,
+        kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore, featureVector));
+
+    const double showerAsymmetry(this->GetLeadingFeature(m_showerAsymmetryFeatureTools, pVertex, slidingFitDataListMap, clusterListMap,
+        kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore, featureVector));
+
+    //const double rPhiFeature(LArMvaHelper::CalculateFeaturesOfType<RPhiFeatureTool>(m_featureToolVector, this, pVertex,
+    //    slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore).at(0).Get());
+
+    double dEdxAsymmetry(0.f), vertexEnergy(0.f);
+
+    if (!m_legacyVariables)
+    {
+        dEdxAsymmetry = this->GetLeadingFeature(m_dEdxAsymmetryFeatureTools, pVertex, slidingFitDataListMap, clusterListMap, kdTreeMap,
+            showerClusterListMap, beamDeweighting, bestFastScore, featureVector);
+
+        vertexEnergy = this->GetVertexEnergy(pVertex, kdTreeMap);
+    }
+
+    return VertexFeatureInfo(
+        beamDeweighting, 0.f, energyKick, localAsymmetry, globalAsymmetry, showerAsymmetry, dEdxAsymmetry, vertexEnergy);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+double TrainedVertexSelectionAlgorithm::GetLeadingFeature(const VertexFeatureTool::FeatureToolVector &featureToolVector,
+    const Vertex *const pVertex, const SlidingFitDataListMap &slidingFitDataListMap, const ClusterListMap &clusterListMap,
+    const KDTreeMap &kdTreeMap, const ShowerClusterListMap &showerClusterListMap, const double beamDeweighting, float &bestFastScore,
+    LArMvaHelper::MvaFeatureVector &featureVector) const
+{
+    featureVector.clear();
+
+    for (VertexFeatureTool *const pFeatureTool : featureToolVector)
+    {
+        pFeatureTool->Run(featureVector, this, pVertex, slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap,
+            beamDeweighting, bestFastScore);
+    }
+
+    return featureVector.at(0).Get();
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -864,6 +913,15 @@ StatusCode TrainedVertexSelectionAlgorithm::ReadSettings(const TiXmlHandle xmlHa
     for (AlgorithmTool *const pAlgorithmTool : algorithmToolVector)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArMvaHelper::AddFeatureToolToVector(pAlgorithmTool, m_featureToolVector));
 
+    m_energyKickFeatureTools = LArMvaHelper::GetFeatureToolsOfType<EnergyKickFeatureTool>(m_featureToolVector);
+    m_localAsymmetryFeatureTools = LArMvaHelper::GetFeatureToolsOfType<LocalAsymmetryFeatureTool>(m_featureToolVector);
+    m_globalAsymmetryFeatureTools = LArMvaHelper::GetFeatureToolsOfType<GlobalAsymmetryFeatureTool>(m_featureToolVector);
+    m_showerAsymmetryFeatureTools = LArMvaHelper::GetFeatureToolsOfType<ShowerAsymmetryFeatureTool>(m_featureToolVector);
+    m_dEdxAsymmetryFeatureTools = LArMvaHelper::GetFeatureToolsOfType<EnergyDepositionAsymmetryFeatureTool>(m_featureToolVector);
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NFeatureThreads", m_nFeatureThreads));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "TrainingSetMode", m_trainingSetMode));
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
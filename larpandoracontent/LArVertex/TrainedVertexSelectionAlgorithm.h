@@ -309,6 +309,22 @@ protected:
         const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
         const pandora::Vertex *const pVertex, VertexFeatureInfoMap &vertexFeatureInfoMap) const;
 
+    /**
+     *  @brief  Populate the vertex feature info map for a vector of vertices, evaluating the vertex features concurrently if so configured.
+     *          The feature tools read only the provided maps and the vertices, so the map is identical to that from serial evaluation.
+     *
+     *  @param  beamConstants the beam constants
+     *  @param  clusterListMap the cluster list map
+     *  @param  slidingFitDataListMap the sliding fit data list map
+     *  @param  showerClusterListMap the shower cluster list map
+     *  @param  kdTreeMap the kd tree map
+     *  @param  vertexVector the vector of vertices
+     *  @param  vertexFeatureInfoMap the map to populate
+     */
+    void PopulateVertexFeatureInfoMap(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
+        const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+        const pandora::VertexVector &vertexVector, VertexFeatureInfoMap &vertexFeatureInfoMap) const;
+
     /**
      *  @brief  Populate the initial vertex score list for a given vertex
      *
@@ -447,6 +463,43 @@ protected:
     void PopulateFinalVertexScoreList(const VertexFeatureInfoMap &vertexFeatureInfoMap, const pandora::Vertex *const pFavouriteVertex,
         const pandora::VertexVector &vertexVector, VertexScoreList &finalVertexScoreList) const;
 
+    /**
+     *  @brief  Calculate the features for a given vertex
+     *
+     *  @param  beamConstants the beam constants
+     *  @param  clusterListMap the cluster list map
+     *  @param  slidingFitDataListMap the sliding fit data list map
+     *  @param  showerClusterListMap the shower cluster list map
+     *  @param  kdTreeMap the kd tree map
+     *  @param  pVertex the vertex
+     *  @param  featureVector scratch space for the feature tool output
+     *
+     *  @return the vertex feature info
+     */
+    VertexFeatureInfo CalculateVertexFeatureInfo(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
+        const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+        const pandora::Vertex *const pVertex, LArMvaHelper::MvaFeatureVector &featureVector) const;
+
+    /**
+     *  @brief  Run a vector of feature tools for a given vertex and return the first feature produced
+     *
+     *  @param  featureToolVector the feature tools
+     *  @param  pVertex the vertex
+     *  @param  slidingFitDataListMap the sliding fit data list map
+     *  @param  clusterListMap the cluster list map
+     *  @param  kdTreeMap the kd tree map
+     *  @param  showerClusterListMap the shower cluster list map
+     *  @param  beamDeweighting the beam deweighting feature
+     *  @param  bestFastScore the best fast score
+     *  @param  featureVector scratch space for the feature tool output
+     *
+     *  @return the first feature
+     */
+    double GetLeadingFeature(const VertexFeatureTool::FeatureToolVector &featureToolVector, const pandora::Vertex *const pVertex,
+        const SlidingFitDataListMap &slidingFitDataListMap, const ClusterListMap &clusterListMap, const KDTreeMap &kdTreeMap,
+        const ShowerClusterListMap &showerClusterListMap, const double beamDeweighting, float &bestFastScore,
+        LArMvaHelper::MvaFeatureVector &featureVector) const;
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     VertexFeatureTool::FeatureToolVector m_featureToolVector; ///< The feature tool vector
@@ -458,6 +511,13 @@ protected:
     std::string m_mcParticleListName;                         ///< The MC particle list for creating training examples
     std::string m_caloHitListName;                            ///< The 2D CaloHit list name
 
+    VertexFeatureTool::FeatureToolVector m_energyKickFeatureTools;      ///< The energy kick feature tools
+    VertexFeatureTool::FeatureToolVector m_localAsymmetryFeatureTools;  ///< The local asymmetry feature tools
+    VertexFeatureTool::FeatureToolVector m_globalAsymmetryFeatureTools; ///< The global asymmetry feature tools
+    VertexFeatureTool::FeatureToolVector m_showerAsymmetryFeatureTools; ///< The shower asymmetry feature tools
+    VertexFeatureTool::FeatureToolVector m_dEdxAsymmetryFeatureTools;   ///< The energy deposition asymmetry feature tools
+    unsigned int m_nFeatureThreads;                                     ///< The number of feature threads (zero for hardware concurrency)
+
     pandora::StringVector m_inputClusterListNames; ///< The list of cluster list names
     unsigned int m_minClusterCaloHits;             ///< The min number of hits parameter in the energy score
     unsigned int m_slidingFitWindow;               ///< The layer window for the sliding linear fits
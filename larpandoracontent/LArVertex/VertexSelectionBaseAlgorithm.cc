@@ -9,6 +9,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
@@ -32,12 +33,21 @@ VertexSelectionBaseAlgorithm::VertexSelectionBaseAlgorithm() :
     m_useDetectorGaps(true),
     m_gapTolerance(0.f),
     m_isEmptyViewAcceptable(true),
-    m_minVertexAcceptableViews(3)
+    m_minVertexAcceptableViews(3),
+    m_useSharedSlidingFitCache(false)
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+VertexSelectionBaseAlgorithm::~VertexSelectionBaseAlgorithm()
+{
+    if (m_useSharedSlidingFitCache)
+        LArSlidingFitCacheHelper::Erase(this->GetPandora());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void VertexSelectionBaseAlgorithm::FilterVertexList(const VertexList *const pInputVertexList, HitKDTree2D &kdTreeU, HitKDTree2D &kdTreeV,
     HitKDTree2D &kdTreeW, VertexVector &filteredVertices) const
 {
@@ -134,12 +144,31 @@ void VertexSelectionBaseAlgorithm::CalculateClusterSlidingFits(const ClusterList
         // Make sure the window size is such that there are not more layers than hits (following TwoDSlidingLinearFit calculation).
         const unsigned int newSlidingFitWindow(
             std::min(static_cast<int>(pCluster->GetNCaloHits()), static_cast<int>(slidingFitPitch * slidingFitWindow)));
-        slidingFitDataList.emplace_back(pCluster, newSlidingFitWindow, slidingFitPitch);
+
+        if (m_useSharedSlidingFitCache)
+        {
+            slidingFitDataList.emplace_back(
+                LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), pCluster, newSlidingFitWindow, slidingFitPitch));
+        }
+        else
+        {
+            slidingFitDataList.emplace_back(pCluster, newSlidingFitWindow, slidingFitPitch);
+        }
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode VertexSelectionBaseAlgorithm::Reset()
+{
+    if (m_useSharedSlidingFitCache)
+        LArSlidingFitCacheHelper::Reset(this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode VertexSelectionBaseAlgorithm::Run()
 {
     const VertexList *pInputVertexList(NULL);
@@ -372,6 +401,17 @@ VertexSelectionBaseAlgorithm::SlidingFitData::SlidingFitData(const pandora::Clus
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+VertexSelectionBaseAlgorithm::SlidingFitData::SlidingFitData(const TwoDSlidingFitResult &slidingFitResult) :
+    m_minLayerDirection(slidingFitResult.GetGlobalMinLayerDirection()),
+    m_maxLayerDirection(slidingFitResult.GetGlobalMaxLayerDirection()),
+    m_minLayerPosition(slidingFitResult.GetGlobalMinLayerPosition()),
+    m_maxLayerPosition(slidingFitResult.GetGlobalMaxLayerPosition()),
+    m_pCluster(slidingFitResult.GetCluster())
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 VertexSelectionBaseAlgorithm::ShowerCluster::ShowerCluster(const pandora::ClusterList &clusterList, const int slidingFitWindow, const float slidingFitPitch) :
     m_clusterList(clusterList),
     m_coordinateVector(this->GetClusterListCoordinateVector(clusterList)),
@@ -442,6 +482,9 @@ StatusCode VertexSelectionBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandl
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "MinVertexAcceptableViews", m_minVertexAcceptableViews));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "UseSharedSlidingFitCache", m_useSharedSlidingFitCache));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -37,6 +37,11 @@ public:
      */
     VertexSelectionBaseAlgorithm();
 
+    /**
+     *  @brief  Destructor
+     */
+    ~VertexSelectionBaseAlgorithm();
+
     /**
      *  @brief  VertexScore class
      */
@@ -129,6 +134,13 @@ public:
          */
         SlidingFitData(const pandora::Cluster *const pCluster, const int slidingFitWindow, const float slidingFitPitch);
 
+        /**
+         *  @brief  Constructor from an existing cluster sliding fit result
+         *
+         *  @param  slidingFitResult the cluster sliding fit result
+         */
+        SlidingFitData(const TwoDSlidingFitResult &slidingFitResult);
+
         /**
          *  @brief  Get the min layer direction
          *
@@ -330,6 +342,7 @@ protected:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
 private:
+    pandora::StatusCode Reset();
     pandora::StatusCode Run();
 
     /**
@@ -413,6 +426,8 @@ private:
 
     bool m_isEmptyViewAcceptable; ///< Whether views entirely empty of hits are classed as 'acceptable' for candidate filtration
     unsigned int m_minVertexAcceptableViews; ///< The minimum number of views in which a candidate must sit on/near a hit or in a gap (or view can be empty)
+
+    bool m_useSharedSlidingFitCache; ///< Whether to obtain cluster sliding fit results via the event-scoped shared cache
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -33,6 +33,7 @@ DlHitTrackShowerIdAlgorithm::DlHitTrackShowerIdAlgorithm() :
     m_imageHeight(256),
     m_imageWidth(256),
     m_tileSize(128.f),
+    m_maxBatchSize(32),
     m_visualize(false),
     m_useTrainingMode(false),
     m_trainingOutputFile("")
@@ -170,79 +171,19 @@ StatusCode DlHitTrackShowerIdAlgorithm::Infer()
         this->GetSparseTileMap(*pCaloHitList, xMin, zMin, nTilesX, sparseMap);
         const int nTiles = sparseMap.size();
 
+        TileHitVectorVector tileHitVectors(nTiles);
+        this->GetTileHits(*pCaloHitList, xMin, zMin, nTilesX, sparseMap, tileHitVectors);
+
         CaloHitList trackHits, showerHits, otherHits;
-        // Process tile
-        // ATTN: Be sure to reset all values to zero after each tile has been processed
-        float **weights = new float *[m_imageHeight];
-        for (int r = 0; r < m_imageHeight; ++r)
-            weights[r] = new float[m_imageWidth]();
-        for (int i = 0; i < nTiles; ++i)
+        // Process tiles in batches, with a single forward pass per batch
+        for (int firstTile = 0; firstTile < nTiles; firstTile += m_maxBatchSize)
         {
-            for (const CaloHit *pCaloHit : *pCaloHitList)
-            {
-                const float x(pCaloHit->GetPositionVector().GetX());
-                const float z(pCaloHit->GetPositionVector().GetZ());
-                // Determine which tile the hit will be assigned to
-                const int tileX = static_cast<int>(std::floor((x - xMin) / m_tileSize));
-                const int tileZ = static_cast<int>(std::floor((z - zMin) / m_tileSize));
-                const int tile = sparseMap.at(tileZ * nTilesX + tileX);
-                if (tile == i)
-                {
-                    // Determine hit position within the tile
-                    const float localX = std::fmod(x - xMin, m_tileSize);
-                    const float localZ = std::fmod(z - zMin, m_tileSize);
-                    // Determine hit pixel within the tile
-                    const int pixelX = static_cast<int>(std::floor(localX * m_imageWidth / m_tileSize));
-                    const int pixelZ = (m_imageHeight - 1) - static_cast<int>(std::floor(localZ * m_imageHeight / m_tileSize));
-                    weights[pixelZ][pixelX] += pCaloHit->GetInputEnergy();
-                }
-            }
+            const int nBatchTiles{std::min(m_maxBatchSize, nTiles - firstTile)};
 
-            // Find min and max charge to allow normalisation
-            float chargeMin{std::numeric_limits<float>::max()}, chargeMax{-std::numeric_limits<float>::max()};
-            for (int r = 0; r < m_imageHeight; ++r)
-            {
-                for (int c = 0; c < m_imageWidth; ++c)
-                {
-                    if (weights[r][c] > chargeMax)
-                        chargeMax = weights[r][c];
-                    if (weights[r][c] < chargeMin)
-                        chargeMin = weights[r][c];
-                }
-            }
-            float chargeRange{chargeMax - chargeMin};
-            if (chargeRange <= 0.f)
-                chargeRange = 1.f;
-
-            // Populate accessor based on normalised weights
-            CaloHitToPixelMap caloHitToPixelMap;
             LArDLHelper::TorchInput input;
-            LArDLHelper::InitialiseInput({1, 1, m_imageHeight, m_imageWidth}, input);
-            auto accessor = input.accessor<float, 4>();
-            for (const CaloHit *pCaloHit : *pCaloHitList)
-            {
-                const float x(pCaloHit->GetPositionVector().GetX());
-                const float z(pCaloHit->GetPositionVector().GetZ());
-                // Determine which tile the hit will be assigned to
-                const int tileX = static_cast<int>(std::floor((x - xMin) / m_tileSize));
-                const int tileZ = static_cast<int>(std::floor((z - zMin) / m_tileSize));
-                const int tile = sparseMap.at(tileZ * nTilesX + tileX);
-                if (tile == i)
-                {
-                    // Determine hit position within the tile
-                    const float localX = std::fmod(x - xMin, m_tileSize);
-                    const float localZ = std::fmod(z - zMin, m_tileSize);
-                    // Determine hit pixel within the tile
-                    const int pixelX = static_cast<int>(std::floor(localX * m_imageWidth / m_tileSize));
-                    const int pixelZ = (m_imageHeight - 1) - static_cast<int>(std::floor(localZ * m_imageHeight / m_tileSize));
-                    accessor[0][0][pixelZ][pixelX] = (weights[pixelZ][pixelX] - chargeMin) / chargeRange;
-                    caloHitToPixelMap.insert(std::make_pair(pCaloHit, std::make_tuple(tileZ, tileX, pixelZ, pixelX)));
-                }
-            }
-            // Reset weights
-            for (int r = 0; r < this->m_imageHeight; ++r)
-                for (int c = 0; c < this->m_imageWidth; ++c)
-                    weights[r][c] = 0.f;
+            LArDLHelper::InitialiseInput({nBatchTiles, 1, m_imageHeight, m_imageWidth}, input);
+            for (int b = 0; b < nBatchTiles; ++b)
+                this->FillTileInput(tileHitVectors.at(firstTile + b), b, input);
 
             // Run the input through the trained model and get the output accessor
             LArDLHelper::TorchInputVector inputs;
@@ -251,24 +192,14 @@ StatusCode DlHitTrackShowerIdAlgorithm::Infer()
             LArDLHelper::Forward(model, inputs, output);
             auto outputAccessor = output.accessor<float, 4>();
 
-            for (const CaloHit *pCaloHit : *pCaloHitList)
+            for (int b = 0; b < nBatchTiles; ++b)
             {
-                auto found{caloHitToPixelMap.find(pCaloHit)};
-                if (found == caloHitToPixelMap.end())
-                    continue;
-                auto pixelMap = found->second;
-                const int tileZ(std::get<0>(pixelMap));
-                const int tileX(std::get<1>(pixelMap));
-                const int tile = sparseMap.at(tileZ * nTilesX + tileX);
-                if (tile == i)
-                { // Make sure we're looking at a hit in the correct tile
-                    const int pixelZ(std::get<2>(pixelMap));
-                    const int pixelX(std::get<3>(pixelMap));
-
+                for (const auto &[pCaloHit, pixelZ, pixelX] : tileHitVectors.at(firstTile + b))
+                {
                     // Apply softmax to loss to get actual probability
-                    float probShower = exp(outputAccessor[0][1][pixelZ][pixelX]);
-                    float probTrack = exp(outputAccessor[0][2][pixelZ][pixelX]);
-                    float probNull = exp(outputAccessor[0][0][pixelZ][pixelX]);
+                    float probShower = exp(outputAccessor[b][1][pixelZ][pixelX]);
+                    float probTrack = exp(outputAccessor[b][2][pixelZ][pixelX]);
+                    float probNull = exp(outputAccessor[b][0][pixelZ][pixelX]);
                     if (probShower > probTrack && probShower > probNull)
                         showerHits.push_back(pCaloHit);
                     else if (probTrack > probShower && probTrack > probNull)
@@ -285,9 +216,6 @@ StatusCode DlHitTrackShowerIdAlgorithm::Infer()
                 }
             }
         }
-        for (int r = 0; r < this->m_imageHeight; ++r)
-            delete[] weights[r];
-        delete[] weights;
 
         if (m_visualize)
         {
@@ -362,6 +290,72 @@ void DlHitTrackShowerIdAlgorithm::GetSparseTileMap(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void DlHitTrackShowerIdAlgorithm::GetTileHits(const CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX,
+    const PixelToTileMap &sparseMap, TileHitVectorVector &tileHitVectors) const
+{
+    for (const CaloHit *pCaloHit : caloHitList)
+    {
+        const float x(pCaloHit->GetPositionVector().GetX());
+        const float z(pCaloHit->GetPositionVector().GetZ());
+        // Determine which tile the hit will be assigned to
+        const int tileX = static_cast<int>(std::floor((x - xMin) / m_tileSize));
+        const int tileZ = static_cast<int>(std::floor((z - zMin) / m_tileSize));
+        const int tile = sparseMap.at(tileZ * nTilesX + tileX);
+        // Determine hit position within the tile
+        const float localX = std::fmod(x - xMin, m_tileSize);
+        const float localZ = std::fmod(z - zMin, m_tileSize);
+        // Determine hit pixel within the tile
+        const int pixelX = static_cast<int>(std::floor(localX * m_imageWidth / m_tileSize));
+        const int pixelZ = (m_imageHeight - 1) - static_cast<int>(std::floor(localZ * m_imageHeight / m_tileSize));
+        tileHitVectors.at(tile).emplace_back(pCaloHit, pixelZ, pixelX);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DlHitTrackShowerIdAlgorithm::FillTileInput(const TileHitVector &tileHits, const int batchIndex, LArDLHelper::TorchInput &input) const
+{
+    auto accessor = input.accessor<float, 4>();
+
+    // Accumulate the charge in each populated pixel
+    IntVector pixels;
+    for (const auto &[pCaloHit, pixelZ, pixelX] : tileHits)
+    {
+        accessor[batchIndex][0][pixelZ][pixelX] += pCaloHit->GetInputEnergy();
+        pixels.emplace_back(pixelZ * m_imageWidth + pixelX);
+    }
+    std::sort(pixels.begin(), pixels.end());
+    pixels.erase(std::unique(pixels.begin(), pixels.end()), pixels.end());
+
+    // Find min and max charge to allow normalisation, with any unpopulated pixels contributing zero charge
+    float chargeMin{std::numeric_limits<float>::max()}, chargeMax{-std::numeric_limits<float>::max()};
+    if (static_cast<int>(pixels.size()) < m_imageHeight * m_imageWidth)
+    {
+        chargeMin = 0.f;
+        chargeMax = 0.f;
+    }
+    for (const int pixel : pixels)
+    {
+        const float charge{accessor[batchIndex][0][pixel / m_imageWidth][pixel % m_imageWidth]};
+        if (charge > chargeMax)
+            chargeMax = charge;
+        if (charge < chargeMin)
+            chargeMin = charge;
+    }
+    float chargeRange{chargeMax - chargeMin};
+    if (chargeRange <= 0.f)
+        chargeRange = 1.f;
+
+    // Normalise the populated pixels, leaving unpopulated pixels at zero
+    for (const int pixel : pixels)
+    {
+        float &charge{accessor[batchIndex][0][pixel / m_imageWidth][pixel % m_imageWidth]};
+        charge = (charge - chargeMin) / chargeRange;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseTrainingMode", m_useTrainingMode));
@@ -414,6 +408,12 @@ StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle
         std::cout << "Error: Invalid image size specification" << std::endl;
         return STATUS_CODE_INVALID_PARAMETER;
     }
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxBatchSize", m_maxBatchSize));
+    if (m_maxBatchSize <= 0)
+    {
+        std::cout << "Error: Invalid maximum batch size" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "Visualize", m_visualize));
 
     return STATUS_CODE_SUCCESS;
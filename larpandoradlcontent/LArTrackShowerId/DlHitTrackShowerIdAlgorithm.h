@@ -29,8 +29,9 @@ public:
     virtual ~DlHitTrackShowerIdAlgorithm();
 
 private:
-    typedef std::map<const pandora::CaloHit *, std::tuple<int, int, int, int>> CaloHitToPixelMap;
     typedef std::map<int, int> PixelToTileMap;
+    typedef std::vector<std::tuple<const pandora::CaloHit *, int, int>> TileHitVector;
+    typedef std::vector<TileHitVector> TileHitVectorVector;
 
     pandora::StatusCode Run();
 
@@ -67,6 +68,28 @@ private:
      */
     void GetSparseTileMap(const pandora::CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX, PixelToTileMap &sparseMap);
 
+    /**
+     *  @brief  Assign CaloHits to their sparse tiles in a single pass, recording the pixel each hit occupies within its tile
+     *
+     *  @param  caloHitList The list of CaloHits to be assigned
+     *  @param  xMin The minimum x-coordinate
+     *  @param  zMin The minimum z-coordinate
+     *  @param  nTilesX The number of tiles in the x direction
+     *  @param  sparseMap The map between pixels and tiles
+     *  @param  tileHitVectors The output hits and pixels for each tile, with hits in CaloHitList order
+     */
+    void GetTileHits(const pandora::CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX,
+        const PixelToTileMap &sparseMap, TileHitVectorVector &tileHitVectors) const;
+
+    /**
+     *  @brief  Populate one image of a batched network input with the normalised charge of the hits in a tile
+     *
+     *  @param  tileHits The hits and pixels for the tile
+     *  @param  batchIndex The index of the image within the batch
+     *  @param  input The batched network input, with all pixels of the image initially zero
+     */
+    void FillTileInput(const TileHitVector &tileHits, const int batchIndex, LArDLHelper::TorchInput &input) const;
+
     pandora::StringVector m_caloHitListNames; ///< Name of input calo hit list
     std::string m_modelFileNameU;             ///< Model file name for U view
     std::string m_modelFileNameV;             ///< Model file name for V view
@@ -77,6 +100,7 @@ private:
     int m_imageHeight;                        ///< Height of images in pixels
     int m_imageWidth;                         ///< Width of images in pixels
     float m_tileSize;                         ///< Size of tile in cm
+    int m_maxBatchSize;                       ///< Maximum number of tiles to process in a single forward pass
     bool m_visualize;                         ///< Whether to visualize the track shower ID scores
     bool m_useTrainingMode;                   ///< Training mode
     std::string m_trainingOutputFile;         ///< Output file name for training examples
@@ -15,6 +15,7 @@
 #include "larpandoracontent/LArHelpers/LArFileHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
 #include "larpandoracontent/LArHelpers/LArVertexHelper.h"
 
 #include "larpandoradlcontent/LArVertex/DlVertexingAlgorithm.h"
@@ -37,7 +38,8 @@ DlVertexingAlgorithm::DlVertexingAlgorithm() :
     m_visualise{false},
     m_writeTree{false},
     m_rng(static_cast<std::mt19937::result_type>(std::chrono::high_resolution_clock::now().time_since_epoch().count())),
-    m_volumeType{"dune_fd_hd"}
+    m_volumeType{"dune_fd_hd"},
+    m_nInferenceThreads{1}
 {
 }
 
@@ -202,7 +204,9 @@ StatusCode DlVertexingAlgorithm::Infer()
         driftMax = std::max(viewDriftMax, driftMax);
     }
 
-    CartesianPointVector vertexCandidatesU, vertexCandidatesV, vertexCandidatesW;
+    std::vector<HitType> views;
+    std::vector<LArDLHelper::TorchInput> inputs;
+    PixelVectorVector pixelVectors;
     for (const std::string &listName : m_caloHitListNames)
     {
         const CaloHitList *pCaloHitList{nullptr};
@@ -213,48 +217,31 @@ StatusCode DlVertexingAlgorithm::Infer()
         if (!isU && !isV && !isW)
             return STATUS_CODE_NOT_ALLOWED;
 
-        LArDLHelper::TorchInput input;
-        PixelVector pixelVector;
-        this->MakeNetworkInputFromHits(*pCaloHitList, view, driftMin, driftMax, wireMin[view], wireMax[view], input, pixelVector);
-
-        // Run the input through the trained model
-        LArDLHelper::TorchInputVector inputs;
-        inputs.push_back(input);
-        LArDLHelper::TorchOutput output;
-        if (isU)
-            LArDLHelper::Forward(m_modelU, inputs, output);
-        else if (isV)
-            LArDLHelper::Forward(m_modelV, inputs, output);
-        else
-            LArDLHelper::Forward(m_modelW, inputs, output);
+        views.emplace_back(view);
+        inputs.emplace_back();
+        pixelVectors.emplace_back();
+        this->MakeNetworkInputFromHits(
+            *pCaloHitList, view, driftMin, driftMax, wireMin[view], wireMax[view], inputs.back(), pixelVectors.back());
+    }
 
-        int colOffset{0}, rowOffset{0}, canvasWidth{m_width}, canvasHeight{m_height};
-        this->GetCanvasParameters(output, pixelVector, colOffset, rowOffset, canvasWidth, canvasHeight);
+    // Network inference and ring accumulation for each view are independent, so can be run concurrently
+    const unsigned int nViews(views.size());
+    if (m_canvases.size() < nViews)
+        m_canvases.resize(nViews);
 
-        float **canvas{new float *[canvasHeight]};
-        for (int row = 0; row < canvasHeight; ++row)
-            canvas[row] = new float[canvasWidth]{};
+    LArThreadingHelper::RunTasks(LArThreadingHelper::GetNThreads(m_nInferenceThreads, nViews), nViews,
+        [&](const unsigned int, const unsigned int viewIndex)
+        { this->FillCanvas(views.at(viewIndex), inputs.at(viewIndex), pixelVectors.at(viewIndex), m_canvases.at(viewIndex)); });
 
-        // we want the maximum value in the num_classes dimension (1) for every pixel
-        auto classes{torch::argmax(output, 1)};
-        // the argmax result is a 1 x height x width tensor where each element is a class id
-        auto classesAccessor{classes.accessor<int64_t, 3>()};
-        const double scaleFactor{std::sqrt(m_height * m_height + m_width * m_width)};
-        std::map<int, bool> haveSeenMap;
-        for (const auto &[row, col] : pixelVector)
-        {
-            const auto cls{classesAccessor[0][row][col]};
-            if (cls > 0 && cls < m_nClasses)
-            {
-                const int inner{static_cast<int>(std::round(std::ceil(scaleFactor * m_thresholds[cls - 1])))};
-                const int outer{static_cast<int>(std::round(std::ceil(scaleFactor * m_thresholds[cls])))};
-                this->DrawRing(canvas, row + rowOffset, col + colOffset, inner, outer, 1.f / (outer * outer - inner * inner));
-            }
-        }
+    CartesianPointVector vertexCandidatesU, vertexCandidatesV, vertexCandidatesW;
+    for (unsigned int viewIndex = 0; viewIndex < nViews; ++viewIndex)
+    {
+        const HitType view{views.at(viewIndex)};
+        const bool isU{view == TPC_VIEW_U}, isV{view == TPC_VIEW_V};
 
         CartesianPointVector positionVector;
         this->MakeWirePlaneCoordinatesFromCanvas(
-            canvas, canvasWidth, canvasHeight, colOffset, rowOffset, view, driftMin, driftMax, wireMin[view], wireMax[view], positionVector);
+            m_canvases.at(viewIndex), view, driftMin, driftMax, wireMin[view], wireMax[view], positionVector);
         if (isU)
             vertexCandidatesU.emplace_back(positionVector.front());
         else if (isV)
@@ -280,7 +267,7 @@ StatusCode DlVertexingAlgorithm::Infer()
                     const CartesianVector trueVertex(x, 0.f, v);
                     PANDORA_MONITORING_API(AddMarkerToVisualization(this->GetPandora(), &trueVertex, "V(true)", BLUE, 3));
                 }
-                else if (isW)
+                else
                 {
                     const CartesianVector trueVertex(x, 0.f, w);
                     PANDORA_MONITORING_API(AddMarkerToVisualization(this->GetPandora(), &trueVertex, "W(true)", BLUE, 3));
@@ -298,10 +285,6 @@ StatusCode DlVertexingAlgorithm::Infer()
             PANDORA_MONITORING_API(ViewEvent(this->GetPandora()));
         }
 #endif
-
-        for (int row = 0; row < canvasHeight; ++row)
-            delete[] canvas[row];
-        delete[] canvas;
     }
 
     int nEmptyLists{0};
@@ -417,9 +400,39 @@ StatusCode DlVertexingAlgorithm::MakeNetworkInputFromHits(const CaloHitList &cal
 
 //-----------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode DlVertexingAlgorithm::MakeWirePlaneCoordinatesFromCanvas(float **canvas, const int canvasWidth, const int canvasHeight,
-    const int columnOffset, const int rowOffset, const HitType view, const float xMin, const float xMax, const float zMin, const float zMax,
-    CartesianPointVector &positionVector) const
+void DlVertexingAlgorithm::FillCanvas(
+    const HitType view, const LArDLHelper::TorchInput &networkInput, const PixelVector &pixelVector, Canvas &canvas)
+{
+    // Run the input through the trained model
+    LArDLHelper::TorchInputVector inputs;
+    inputs.push_back(networkInput);
+    LArDLHelper::TorchOutput output;
+    if (view == TPC_VIEW_U)
+        LArDLHelper::Forward(m_modelU, inputs, output);
+    else if (view == TPC_VIEW_V)
+        LArDLHelper::Forward(m_modelV, inputs, output);
+    else
+        LArDLHelper::Forward(m_modelW, inputs, output);
+
+    this->GetCanvasParameters(output, pixelVector, canvas.m_columnOffset, canvas.m_rowOffset, canvas.m_width, canvas.m_height);
+    canvas.m_values.assign(canvas.m_width * canvas.m_height, 0.f);
+
+    // we want the maximum value in the num_classes dimension (1) for every pixel
+    auto classes{torch::argmax(output, 1)};
+    // the argmax result is a 1 x height x width tensor where each element is a class id
+    auto classesAccessor{classes.accessor<int64_t, 3>()};
+    for (const auto &[row, col] : pixelVector)
+    {
+        const auto cls{classesAccessor[0][row][col]};
+        if (cls > 0 && cls < m_nClasses)
+            this->DrawRing(canvas, row + canvas.m_rowOffset, col + canvas.m_columnOffset, m_ringStencils.at(cls), m_ringWeights.at(cls));
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode DlVertexingAlgorithm::MakeWirePlaneCoordinatesFromCanvas(const Canvas &canvas, const HitType view, const float xMin,
+    const float xMax, const float zMin, const float zMax, CartesianPointVector &positionVector) const
 {
     // ATTN If wire w pitches vary between TPCs, exception will be raised in initialisation of lar pseudolayer plugin
     const LArTPC *const pTPC(this->GetPandora().GetGeometry()->GetLArTPCMap().begin()->second);
@@ -430,17 +443,20 @@ StatusCode DlVertexingAlgorithm::MakeWirePlaneCoordinatesFromCanvas(float **canv
 
     float best{-1.f};
     int rowBest{0}, colBest{0};
-    for (int row = 0; row < canvasHeight; ++row)
-        for (int col = 0; col < canvasWidth; ++col)
-            if (canvas[row][col] > 0 && canvas[row][col] > best)
+    for (int row = 0; row < canvas.m_height; ++row)
+    {
+        const float *const pRow{canvas.m_values.data() + row * canvas.m_width};
+        for (int col = 0; col < canvas.m_width; ++col)
+            if (pRow[col] > 0 && pRow[col] > best)
             {
-                best = canvas[row][col];
+                best = pRow[col];
                 rowBest = row;
                 colBest = col;
             }
+    }
 
-    const float x{static_cast<float>((colBest - columnOffset) * dx + xMin)};
-    const float z{static_cast<float>((rowBest - rowOffset) * dz + zMin)};
+    const float x{static_cast<float>((colBest - canvas.m_columnOffset) * dx + xMin)};
+    const float z{static_cast<float>((rowBest - canvas.m_rowOffset) * dz + zMin)};
 
     CartesianVector pt(x, 0.f, z);
     positionVector.emplace_back(pt);
@@ -485,7 +501,7 @@ void DlVertexingAlgorithm::GetCanvasParameters(const LArDLHelper::TorchOutput &n
 
 //-----------------------------------------------------------------------------------------------------------------------------------------
 
-void DlVertexingAlgorithm::DrawRing(float **canvas, const int row, const int col, const int inner, const int outer, const float weight) const
+void DlVertexingAlgorithm::MakeRingStencil(const int inner, const int outer, PixelVector &stencil) const
 {
     // Set the starting position for each circle bounding the ring
     int c1{inner}, r1{0}, c2{outer}, r2{0};
@@ -504,26 +520,26 @@ void DlVertexingAlgorithm::DrawRing(float **canvas, const int row, const int col
         // Fill the pixels from inner to outer in the current row and their mirror pixels in the other octants
         for (int c = cp1; c <= cp2; ++c)
         {
-            canvas[row + rp2][col + c] += weight;
+            stencil.emplace_back(rp2, c);
             if (rp2 != c)
-                canvas[row + c][col + rp2] += weight;
+                stencil.emplace_back(c, rp2);
             if (rp2 != 0 && cp2 != 0)
             {
-                canvas[row - rp2][col - c] += weight;
+                stencil.emplace_back(-rp2, -c);
                 if (rp2 != c)
-                    canvas[row - c][col - rp2] += weight;
+                    stencil.emplace_back(-c, -rp2);
             }
             if (rp2 != 0)
             {
-                canvas[row - rp2][col + c] += weight;
+                stencil.emplace_back(-rp2, c);
                 if (rp2 != c)
-                    canvas[row + c][col - rp2] += weight;
+                    stencil.emplace_back(c, -rp2);
             }
             if (cp2 != 0)
             {
-                canvas[row + rp2][col - c] += weight;
+                stencil.emplace_back(rp2, -c);
                 if (rp2 != c)
-                    canvas[row - c][col + rp2] += weight;
+                    stencil.emplace_back(-c, rp2);
             }
         }
         // Only update the inner location while it remains in the octant (outer ring also remains in the octant of course, but the logic of
@@ -537,6 +553,16 @@ void DlVertexingAlgorithm::DrawRing(float **canvas, const int row, const int col
 
 //-----------------------------------------------------------------------------------------------------------------------------------------
 
+void DlVertexingAlgorithm::DrawRing(Canvas &canvas, const int row, const int col, const PixelVector &stencil, const float weight) const
+{
+    // ATTN Stencil pixels are visited in the order in which the ring algorithm fills them, so accumulated values are unchanged
+    float *const pCentre{canvas.m_values.data() + row * canvas.m_width + col};
+    for (const auto &[rowOffset, colOffset] : stencil)
+        pCentre[rowOffset * canvas.m_width + colOffset] += weight;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------------
+
 void DlVertexingAlgorithm::Update(const int radius2, int &col, int &row) const
 {
     // Bresenham midpoint circle algorithm to determine if we should update the column position
@@ -890,6 +916,20 @@ StatusCode DlVertexingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "RootFileName", m_rootFileName));
         }
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "OutputVertexListName", m_outputVertexListName));
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NInferenceThreads", m_nInferenceThreads));
+
+        // Precompute the ring stencil and weight for each distance class
+        const double scaleFactor{std::sqrt(m_height * m_height + m_width * m_width)};
+        m_ringStencils.resize(std::max(m_nClasses, 1));
+        m_ringWeights.resize(std::max(m_nClasses, 1));
+        for (int cls = 1; cls < m_nClasses; ++cls)
+        {
+            const int inner{static_cast<int>(std::round(std::ceil(scaleFactor * m_thresholds[cls - 1])))};
+            const int outer{static_cast<int>(std::round(std::ceil(scaleFactor * m_thresholds[cls])))};
+            this->MakeRingStencil(inner, outer, m_ringStencils.at(cls));
+            m_ringWeights.at(cls) = 1.f / (outer * outer - inner * inner);
+        }
     }
 
     PANDORA_RETURN_RESULT_IF_AND_IF(
@@ -57,6 +57,22 @@ private:
 
     typedef std::pair<int, int> Pixel; // A Pixel is a row, column pair
     typedef std::vector<Pixel> PixelVector;
+    typedef std::vector<PixelVector> PixelVectorVector;
+
+    /**
+     *  @brief  Canvas class, a contiguous row-major buffer of vertex scores, reused between events
+     */
+    class Canvas
+    {
+    public:
+        pandora::FloatVector m_values; ///< The canvas values, with row r and column c at index r * m_width + c
+        int m_width;                   ///< The canvas width
+        int m_height;                  ///< The canvas height
+        int m_columnOffset;            ///< The column offset used when populating the canvas
+        int m_rowOffset;               ///< The row offset used when populating the canvas
+    };
+
+    typedef std::vector<Canvas> CanvasVector;
 
     pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -80,14 +96,23 @@ private:
     pandora::StatusCode MakeNetworkInputFromHits(const pandora::CaloHitList &caloHits, const pandora::HitType view, const float xMin,
         const float xMax, const float zMin, const float zMax, LArDLHelper::TorchInput &networkInput, PixelVector &pixelVector) const;
 
+    /*
+     *  @brief  Run the network for a view and accumulate the rings for each classified pixel on a canvas. This is independent of the
+     *          Pandora instance state, allowing the views to be processed concurrently.
+     *
+     *  @param  view The wire plane view
+     *  @param  networkInput The network input for the view
+     *  @param  pixelVector The vector of populated pixels
+     *  @param  canvas The output canvas
+     **/
+    void FillCanvas(
+        const pandora::HitType view, const LArDLHelper::TorchInput &networkInput, const PixelVector &pixelVector, Canvas &canvas);
+
     /*
      *  @brief  Create a list of wire plane-space coordinates from a canvas
      *
      *  @param  canvas The input canvas
-     *  @param  canvasWidth The width of the canvas
-     *  @param  canvasHeight The height of the canvas
-     *  @param  columnOffset The column offset used when populating the canvas
-     *  @param  rowOffset The row offset used when populating the canvas
+     *  @param  view The wire plane view
      *  @param  xMin The minimum x coordinate for the hits
      *  @param  xMax The maximum x coordinate for the hits
      *  @param  zMin The minimum x coordinate for the hits
@@ -96,9 +121,8 @@ private:
      *
      *  @return The StatusCode resulting from the function
      **/
-    pandora::StatusCode MakeWirePlaneCoordinatesFromCanvas(float **canvas, const int canvasWidth, const int canvasHeight,
-        const int columnOffset, const int rowOffset, const pandora::HitType view, const float xMin, const float xMax, const float zMin,
-        const float zMax, pandora::CartesianPointVector &positionVector) const;
+    pandora::StatusCode MakeWirePlaneCoordinatesFromCanvas(const Canvas &canvas, const pandora::HitType view, const float xMin,
+        const float xMax, const float zMin, const float zMax, pandora::CartesianPointVector &positionVector) const;
 
     /**
      *  @brief  Determines the parameters of the canvas for extracting the vertex location.
@@ -117,26 +141,33 @@ private:
         int &rowOffset, int &width, int &height) const;
 
     /**
-     *  @brief  Add a filled ring to the specified canvas.
+     *  @brief  Make the stencil for a filled ring, as a sequence of pixel offsets from the centre of the ring.
      *          The ring has an inner radius based on the minimum predicted distance to the vertex and an outer radius based on the maximum
      *          predicted distance to the vertex. The centre of the ring is the location of the hit used to predict the distance to the
-     *          vertex. Each pixel to be filled is augmented by the specified weight. In this way, once all hits have been considered, a
-     *          consensus view emerges of the likely vertex location based on the overlap of various rings centred at different locations.
+     *          vertex. Adding a weight to each pixel of the stencil in turn, once all hits have been considered, a consensus view emerges
+     *          of the likely vertex location based on the overlap of various rings centred at different locations.
      *
      *          The underlying implementation is a variant of the Bresenham midpoint circle algorithm and therefore only computes pixel
      *          coordinates for one octant of each circle (one of radius 'inner', one of radius 'outer') and interpolates the fill between
      *          points using integer arithmetic, guaranteeing each pixel of the ring is filled once and only once, and then mirrored to the
      *          remaining seven octants.
      *
-     *  @param  networkOutput The TorchOutput object populated by the network inference step
-     *  @param  pixelVector The vector of populated pixels
-     *  @param  thresholds The fractional distance thresholds representing the classes predicted by the network
-     *  @param  columnOffset The output column offset for the canvas
-     *  @param  rowOffset The output row offset for the canvas
-     *  @param  width The output width for the canvas
-     *  @param  height The output height for the canvas
+     *  @param  inner The inner radius of the ring
+     *  @param  outer The outer radius of the ring
+     *  @param  stencil The output vector of row, column offsets
+     */
+    void MakeRingStencil(const int inner, const int outer, PixelVector &stencil) const;
+
+    /**
+     *  @brief  Add a filled ring to the specified canvas, augmenting each pixel of a precomputed ring stencil by the specified weight
+     *
+     *  @param  canvas The canvas to update
+     *  @param  row The canvas row at the centre of the ring
+     *  @param  col The canvas column at the centre of the ring
+     *  @param  stencil The ring stencil
+     *  @param  weight The weight to add to each pixel
      */
-    void DrawRing(float **canvas, const int row, const int col, const int inner, const int outer, const float weight) const;
+    void DrawRing(Canvas &canvas, const int row, const int col, const PixelVector &stencil, const float weight) const;
 
     /**
      *  @brief  Update the coordinates along the loci of a circle.
@@ -237,6 +268,10 @@ private:
     std::mt19937 m_rng;                       ///< The random number generator
     std::vector<double> m_thresholds;         ///< Distance class thresholds
     std::string m_volumeType;                 ///< The name of the fiducial volume type for the monitoring output
+    unsigned int m_nInferenceThreads;         ///< The number of threads for concurrent view processing (0 for hardware concurrency)
+    PixelVectorVector m_ringStencils;         ///< The ring stencil for each distance class
+    pandora::FloatVector m_ringWeights;       ///< The ring weight for each distance class
+    CanvasVector m_canvases;                  ///< The canvas for each view, reused between events
 };
 
 } // namespace lar_dl_content